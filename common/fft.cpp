@@ -31,6 +31,10 @@
 #include "common/util.h"
 #include "common/textconsole.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace Common {
 
 FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
@@ -176,11 +180,74 @@ static void name(Complex *z, const float *wre, unsigned int n) { \
 	} while(--n);\
 }
 
+#ifdef __SSE2__
+
+/* Same as pass(), but computes the butterflies of z[k] and z[k + 1] together.
+ * Both complex values go into one register, the operations are the same as in
+ * TRANSFORM, so the results are identical. */
+static void passSSE2(Complex *z, const float *wre, unsigned int n) {
+	float t1, t2, t3, t4, t5, t6;
+	int o1 = 2 * n;
+	int o2 = 4 * n;
+	int o3 = 6 * n;
+	const float *wim = wre + o1;
+	n--;
+
+	TRANSFORM_ZERO(z[0], z[o1], z[o2], z[o3]);
+	TRANSFORM(z[1], z[o1 + 1], z[o2 + 1], z[o3 + 1], wre[1], wim[-1]);
+
+	// Negate the real or the imaginary parts
+	const __m128 signRe = _mm_castsi128_ps(_mm_set_epi32(0, 0x80000000, 0, 0x80000000));
+	const __m128 signIm = _mm_castsi128_ps(_mm_set_epi32(0x80000000, 0, 0x80000000, 0));
+
+	do {
+		z += 2;
+		wre += 2;
+		wim -= 2;
+
+		// wRe = { wre[0], wre[0], wre[1], wre[1] }, wIm = { wim[0], wim[0], wim[-1], wim[-1] }
+		const __m128 wRe = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)wre);
+		const __m128 wIm = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(wim - 1));
+		const __m128 wr = _mm_unpacklo_ps(wRe, wRe);
+		const __m128 wi = _mm_shuffle_ps(wIm, wIm, _MM_SHUFFLE(0, 0, 1, 1));
+
+		const __m128 a0 = _mm_loadu_ps(&z[0].re);
+		const __m128 a1 = _mm_loadu_ps(&z[o1].re);
+		const __m128 a2 = _mm_loadu_ps(&z[o2].re);
+		const __m128 a3 = _mm_loadu_ps(&z[o3].re);
+
+		// { t1, t2 } = a2 * conj(w), { t5, t6 } = a3 * w
+		const __m128 a2Swap = _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(2, 3, 0, 1));
+		const __m128 a3Swap = _mm_shuffle_ps(a3, a3, _MM_SHUFFLE(2, 3, 0, 1));
+		const __m128 t12 = _mm_add_ps(_mm_mul_ps(a2, wr), _mm_mul_ps(a2Swap, _mm_xor_ps(wi, signIm)));
+		const __m128 t56 = _mm_add_ps(_mm_mul_ps(a3, wr), _mm_mul_ps(a3Swap, _mm_xor_ps(wi, signRe)));
+
+		// sum = { t1 + t5, t2 + t6 }, diff = { t3, -t4 }
+		const __m128 sum  = _mm_add_ps(t56, t12);
+		const __m128 diff = _mm_sub_ps(t56, t12);
+
+		// i * diff = { t4, t3 }
+		const __m128 diffRot = _mm_xor_ps(_mm_shuffle_ps(diff, diff, _MM_SHUFFLE(2, 3, 0, 1)), signRe);
+
+		_mm_storeu_ps(&z[0].re,  _mm_add_ps(a0, sum));
+		_mm_storeu_ps(&z[o2].re, _mm_sub_ps(a0, sum));
+		_mm_storeu_ps(&z[o1].re, _mm_add_ps(a1, diffRot));
+		_mm_storeu_ps(&z[o3].re, _mm_sub_ps(a1, diffRot));
+	} while (--n);
+}
+
+#undef BUTTERFLIES
+#define BUTTERFLIES BUTTERFLIES_BIG
+
+#else
+
 PASS(pass)
 #undef BUTTERFLIES
 #define BUTTERFLIES BUTTERFLIES_BIG
 PASS(pass_big)
 
+#endif
+
 void FFT::fft4(Complex *z) {
 	float t1, t2, t3, t4, t5, t6, t7, t8;
 
@@ -245,10 +312,14 @@ void FFT::fft(int n, int logn, Complex *z) {
 		fft((n / 4), logn - 2, z + (n / 4) * 2);
 		fft((n / 4), logn - 2, z + (n / 4) * 3);
 		assert(_cosTables[logn - 4]);
+#ifdef __SSE2__
+		passSSE2(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
+#else
 		if (n > 1024)
 			pass_big(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
 		else
 			pass(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
+#endif
 	}
 }
 
@@ -26,7 +26,6 @@
 #define COMMON_HUFFMAN_H
 
 #include "common/array.h"
-#include "common/list.h"
 #include "common/types.h"
 
 namespace Common {
@@ -63,29 +62,43 @@ public:
 	uint32 getSymbol(BITSTREAM &bits) const;
 
 private:
-	struct Symbol {
-		uint32 code;
-		uint32 symbol;
+	/**
+	 * An entry of the lookup tables.
+	 *
+	 * Codes up to _primaryBits long are resolved by a single lookup in the
+	 * primary table. Longer codes share their first _primaryBits bits with
+	 * other codes; the primary entry for those points to a secondary table,
+	 * which is indexed with the following subTableBits bits.
+	 */
+	struct TableEntry {
+		uint32 symbol;      ///< The symbol, or the offset of the secondary table.
+		uint8  length;      ///< Length of the code (in the current table), 0 if invalid.
+		uint8  subTableBits; ///< Index size of the secondary table, 0 for symbols.
 
-		Symbol(uint32 c, uint32 s) : code(c), symbol(s) {}
+		TableEntry() : symbol(0), length(0), subTableBits(0) {}
 	};
 
-	typedef List<Symbol> CodeList;
-	typedef Array<CodeList> CodeLists;
+	/** Maximum index size of the primary table. */
+	static const uint8 _maxPrimaryBits = 9;
 
-	/** Lists of codes and their symbols, sorted by code length. */
-	CodeLists _codes;
+	/** Index size of the primary table, depends on the longest code. */
+	uint8 _primaryBits;
 
-	/** Prefix lookup table used to speed up the decoding of short codes. */
-	struct PrefixEntry {
-		uint32 symbol;
-		uint8  length;
+	/** The primary table, followed by all secondary tables. */
+	Array<TableEntry> _table;
 
-		PrefixEntry() : length(0xFF) {}
-	};
+	/** Return the first bits of a code, the ones read first from the stream. */
+	static uint32 getCodePrefix(uint32 code, uint8 length, uint8 prefixLength) {
+		return BITSTREAM::isMSB2LSB() ? (code >> (length - prefixLength)) : (code & ((1 << prefixLength) - 1));
+	}
 
-	static const uint8 _prefixTableBits = 8;
-	PrefixEntry _prefixTable[1 << _prefixTableBits];
+	/** Return the remaining bits of a code after its first prefixLength bits. */
+	static uint32 getCodeSuffix(uint32 code, uint8 length, uint8 prefixLength) {
+		return BITSTREAM::isMSB2LSB() ? (code & ((1 << (length - prefixLength)) - 1)) : (code >> prefixLength);
+	}
+
+	/** Enter a code into the table at offset, indexed by tableBits bits. */
+	void fillTable(uint32 offset, uint8 tableBits, uint32 code, uint8 length, uint32 symbol, uint8 subTableBits);
 };
 
 template <class BITSTREAM>
@@ -101,62 +114,87 @@ Huffman<BITSTREAM>::Huffman(uint8 maxLength, uint32 codeCount, const uint32 *cod
 
 	assert(maxLength <= 32);
 
-	// Codes that don't fit in the prefix table are stored in the _codes array
-	_codes.resize(MAX(maxLength - _prefixTableBits, 0));
+	_primaryBits = MIN(maxLength, _maxPrimaryBits);
+
+	// Find the longest code for every primary table slot that needs a
+	// secondary table, to size those tables
+	Array<uint8> subTableBits;
+	subTableBits.resize(1 << _primaryBits);
+	for (uint32 i = 0; i < (1u << _primaryBits); i++)
+		subTableBits[i] = 0;
+
+	for (uint32 i = 0; i < codeCount; i++) {
+		if (lengths[i] <= _primaryBits)
+			continue;
+
+		const uint32 prefix = getCodePrefix(codes[i], lengths[i], _primaryBits);
+		subTableBits[prefix] = MAX<uint8>(subTableBits[prefix], lengths[i] - _primaryBits);
+	}
+
+	// Lay out the secondary tables after the primary one
+	Array<uint32> subTableOffset;
+	subTableOffset.resize(1 << _primaryBits);
+
+	uint32 tableSize = 1 << _primaryBits;
+	for (uint32 i = 0; i < (1u << _primaryBits); i++) {
+		subTableOffset[i] = tableSize;
+		if (subTableBits[i])
+			tableSize += 1 << subTableBits[i];
+	}
+
+	_table.resize(tableSize);
+
+	// Point the primary entries to their secondary tables
+	for (uint32 i = 0; i < (1u << _primaryBits); i++)
+		if (subTableBits[i])
+			fillTable(0, _primaryBits, i, _primaryBits, subTableOffset[i], subTableBits[i]);
 
-	for (uint i = 0; i < codeCount; i++) {
-		uint8 length = lengths[i];
+	for (uint32 i = 0; i < codeCount; i++) {
+		const uint8 length = lengths[i];
 
 		// The symbol. If none were specified, just assume it's identical to the code index
-		uint32 symbol = symbols ? symbols[i] : i;
-
-		if (length <= _prefixTableBits) {
-			// Short codes go in the prefix lookup table. Set all the entries in the table
-			// with an index starting with the code to the symbol value.
-			uint32 startIndex;
-			if (BITSTREAM::isMSB2LSB()) {
-				startIndex = codes[i] << (_prefixTableBits - length);
-			} else {
-				startIndex = REVERSEBITS(codes[i]) >> (32 - _prefixTableBits);
-			}
-
-			uint32 endIndex = startIndex | ((1 << (_prefixTableBits - length)) - 1);
-
-			for (uint32 j = startIndex; j <= endIndex; j++) {
-				uint32 index = BITSTREAM::isMSB2LSB() ? j : REVERSEBITS(j) >> (32 - _prefixTableBits);
-				_prefixTable[index].symbol = symbol;
-				_prefixTable[index].length = length;
-			}
+		const uint32 symbol = symbols ? symbols[i] : i;
+
+		if (length <= _primaryBits) {
+			fillTable(0, _primaryBits, codes[i], length, symbol, 0);
 		} else {
-			// Put the code and symbol into the correct list for the length
-			_codes[lengths[i] - 1 - _prefixTableBits].push_back(Symbol(codes[i], symbol));
+			const uint32 prefix = getCodePrefix(codes[i], length, _primaryBits);
+			const uint32 subCode = getCodeSuffix(codes[i], length, _primaryBits);
+
+			fillTable(subTableOffset[prefix], subTableBits[prefix], subCode, length - _primaryBits, symbol, 0);
 		}
 	}
 }
 
 template <class BITSTREAM>
-uint32 Huffman<BITSTREAM>::getSymbol(BITSTREAM &bits) const {
-	uint32 code = bits.peekBits(_prefixTableBits);
-
-	uint8 length = _prefixTable[code].length;
-
-	if (length != 0xFF) {
-		bits.skip(length);
-		return _prefixTable[code].symbol;
-	} else {
-		bits.skip(_prefixTableBits);
+void Huffman<BITSTREAM>::fillTable(uint32 offset, uint8 tableBits, uint32 code, uint8 length, uint32 symbol, uint8 subTableBits) {
+	// Set all the entries in the table with an index starting with the code
+	// to the symbol value. Codes are stored in reading order, so in LSB2MSB
+	// streams the code occupies the lower bits of the index.
+	const uint32 freeBits = tableBits - length;
+
+	for (uint32 j = 0; j < (1u << freeBits); j++) {
+		TableEntry &entry = _table[offset + (BITSTREAM::isMSB2LSB() ? ((code << freeBits) | j) : (code | (j << length)))];
+		entry.symbol = symbol;
+		entry.length = length;
+		entry.subTableBits = subTableBits;
+	}
+}
 
-		for (uint32 i = 0; i < _codes.size(); i++) {
-			bits.addBit(code, i + _prefixTableBits);
+template <class BITSTREAM>
+uint32 Huffman<BITSTREAM>::getSymbol(BITSTREAM &bits) const {
+	const TableEntry *entry = &_table[bits.peekBits(_primaryBits)];
 
-			for (typename CodeList::const_iterator cCode = _codes[i].begin(); cCode != _codes[i].end(); ++cCode)
-				if (code == cCode->code)
-					return cCode->symbol;
-		}
+	if (entry->subTableBits) {
+		bits.skip(_primaryBits);
+		entry = &_table[entry->symbol + bits.peekBits(entry->subTableBits)];
 	}
 
-	error("Unknown Huffman code");
-	return 0;
+	if (!entry->length)
+		error("Unknown Huffman code");
+
+	bits.skip(entry->length);
+	return entry->symbol;
 }
 
 } // End of namespace Common
@@ -247,6 +247,8 @@
 //    - Define this if your system has problems reading e.g. an int32 from an odd address
 // SMALL_SCREEN_DEVICE
 //    - ...
+// LOW_MEMORY_DEVICE
+//    - Defined on ports with little memory to spare, engines keep their caches small there
 // ...
 
 
@@ -336,6 +338,15 @@
 
 #endif
 
+//
+// Handhelds and consoles with little memory to spare
+//
+#if defined(__DS__) || defined(__PSP__) || defined(PSP2) || defined(__3DS__) || \
+	  defined(__PLAYSTATION2__) || defined(__DC__) || defined(__N64__) || \
+	  defined(GP2X) || defined(_WIN32_WCE)
+	#define LOW_MEMORY_DEVICE
+#endif
+
 #if defined(USE_TREMOR) && !defined(USE_VORBIS)
 #define USE_VORBIS // make sure this one is defined together with USE_TREMOR!
 #endif
@@ -23,7 +23,6 @@
 #include "bladerunner/slice_animations.h"
 
 #include "bladerunner/bladerunner.h"
-#include "bladerunner/time.h"
 
 #include "common/debug.h"
 #include "common/file.h"
@@ -31,6 +30,15 @@
 
 namespace BladeRunner {
 
+// Memory for the loaded pages of the slice animations. The animations of a
+// scene fit easily, the whole CDFRAMES archives (hundreds of MB) don't, so the
+// least recently used pages get evicted.
+#ifdef LOW_MEMORY_DEVICE
+#define BLADERUNNER_PAGE_CACHE_SIZE (16 * 1024 * 1024)
+#else
+#define BLADERUNNER_PAGE_CACHE_SIZE (96 * 1024 * 1024)
+#endif
+
 bool SliceAnimations::open(const Common::String &name) {
 	Common::File file;
 	if (!file.open(_vm->getResourceStream(name), name))
@@ -81,6 +89,10 @@ bool SliceAnimations::open(const Common::String &name) {
 	for (uint32 i = 0; i != _pageCount; ++i)
 		_pages[i]._data = nullptr;
 
+	// The page of the frame returned last is still in use by the slice
+	// renderer, so there has to be room for at least one more
+	_maxLoadedPages = MAX<uint32>(BLADERUNNER_PAGE_CACHE_SIZE / _pageSize, 2);
+
 	return true;
 }
 
@@ -220,8 +232,6 @@ void *SliceAnimations::PageFile::loadPage(uint32 pageNumber) {
 
 	uint32 pageSize = _sliceAnimations->_pageSize;
 
-	// TODO: Retire oldest pages if we exceed some memory limit
-
 	void *data = malloc(pageSize);
 	_files[_pageOffsetsFileIdx[pageNumber]].seek(_pageOffsets[pageNumber], SEEK_SET);
 	uint32 r = _files[_pageOffsetsFileIdx[pageNumber]].read(data, pageSize);
@@ -259,6 +269,16 @@ void *SliceAnimations::getFramePtr(uint32 animation, uint32 frame) {
 	uint32 pageOffset  = frameOffset % _pageSize;
 
 	if (_pages[page]._data == nullptr) {                          // if not cached already
+		// Evict the least recently used pages. The most recently used one
+		// is never evicted, as the caller of the last getFramePtr() may still
+		// be using it.
+		while (_pageLRU.size() >= _maxLoadedPages) {
+			uint32 oldPage = _pageLRU.back();
+			_pageLRU.pop_back();
+			free(_pages[oldPage]._data);
+			_pages[oldPage]._data = nullptr;
+		}
+
 		_pages[page]._data = _coreAnimPageFile.loadPage(page);    // look in COREANIM first
 
 		if (_pages[page]._data == nullptr) {                      // if not in COREAMIM
@@ -268,9 +288,14 @@ void *SliceAnimations::getFramePtr(uint32 animation, uint32 frame) {
 				error("Unable to locate page %d for animation %d frame %d", page, animation, frame);
 			}
 		}
-	}
 
-	_pages[page]._lastAccess = _vm->_time->currentSystem();
+		_pageLRU.push_front(page);
+		_pages[page]._lruPosition = _pageLRU.begin();
+	} else if (_pages[page]._lruPosition != _pageLRU.begin()) {
+		_pageLRU.erase(_pages[page]._lruPosition);
+		_pageLRU.push_front(page);
+		_pages[page]._lruPosition = _pageLRU.begin();
+	}
 
 	return (byte *)_pages[page]._data + pageOffset;
 }
@@ -25,6 +25,7 @@
 
 #include "common/array.h"
 #include "common/file.h"
+#include "common/list.h"
 #include "common/str.h"
 #include "common/types.h"
 
@@ -58,9 +59,9 @@ class SliceAnimations {
 
 	struct Page {
 		void   *_data;
-		uint32 _lastAccess;
+		Common::List<uint32>::iterator _lruPosition;
 
-		Page() : _data(nullptr), _lastAccess(0) {}
+		Page() : _data(nullptr) {}
 	};
 
 	struct PageFile {
@@ -87,6 +88,8 @@ class SliceAnimations {
 	Common::Array<Palette>      _palettes;
 	Common::Array<Animation>    _animations;
 	Common::Array<Page>         _pages;
+	Common::List<uint32>        _pageLRU; // loaded pages, most recently used first
+	uint32                      _maxLoadedPages;
 
 	PageFile _coreAnimPageFile;
 	PageFile _framesPageFile;
@@ -99,7 +102,8 @@ public:
 		, _timestamp(0)
 		, _pageSize(0)
 		, _pageCount(0)
-		, _paletteCount(0) {}
+		, _paletteCount(0)
+		, _maxLoadedPages(0) {}
 	~SliceAnimations();
 
 	bool open(const Common::String &name);
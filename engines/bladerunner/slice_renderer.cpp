@@ -32,6 +32,10 @@
 #include "common/rect.h"
 #include "common/util.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace BladeRunner {
 
 SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
@@ -537,6 +541,52 @@ void SliceRenderer::drawOnScreen(int animationId, int animationFrame, int screen
 	}
 }
 
+// Draws a horizontal span of a single color and depth, where it passes the
+// depth test. The span must lie within the surface.
+template<typename PixelType>
+static void drawSpan(PixelType *dst, uint16 *zbuffer, int count, uint16 z, uint32 color) {
+	int i = 0;
+
+#ifdef __SSE2__
+	if (sizeof(PixelType) > 1) {
+		// SSE2 only has signed 16-bit compares, so flip the sign bits
+		const __m128i bias = _mm_set1_epi16((int16)0x8000);
+		const __m128i depth = _mm_set1_epi16((int16)z);
+		const __m128i biasedDepth = _mm_xor_si128(depth, bias);
+		const __m128i color16 = _mm_set1_epi16((int16)color);
+		const __m128i color32 = _mm_set1_epi32((int32)color);
+
+		for (; i + 8 <= count; i += 8) {
+			__m128i oldDepth = _mm_loadu_si128((const __m128i *)(zbuffer + i));
+			__m128i mask = _mm_cmpgt_epi16(_mm_xor_si128(oldDepth, bias), biasedDepth);
+			if (_mm_movemask_epi8(mask) == 0) {
+				continue;
+			}
+			_mm_storeu_si128((__m128i *)(zbuffer + i), _mm_or_si128(_mm_and_si128(mask, depth), _mm_andnot_si128(mask, oldDepth)));
+
+			if (sizeof(PixelType) == 2) {
+				__m128i pixels = _mm_loadu_si128((const __m128i *)(dst + i));
+				_mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_and_si128(mask, color16), _mm_andnot_si128(mask, pixels)));
+			} else {
+				__m128i maskLo = _mm_unpacklo_epi16(mask, mask);
+				__m128i maskHi = _mm_unpackhi_epi16(mask, mask);
+				__m128i pixelsLo = _mm_loadu_si128((const __m128i *)(dst + i));
+				__m128i pixelsHi = _mm_loadu_si128((const __m128i *)(dst + i + 4));
+				_mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_and_si128(maskLo, color32), _mm_andnot_si128(maskLo, pixelsLo)));
+				_mm_storeu_si128((__m128i *)(dst + i + 4), _mm_or_si128(_mm_and_si128(maskHi, color32), _mm_andnot_si128(maskHi, pixelsHi)));
+			}
+		}
+	}
+#endif
+
+	for (; i < count; ++i) {
+		if (z < zbuffer[i]) {
+			zbuffer[i] = z;
+			dst[i] = (PixelType)color;
+		}
+	}
+}
+
 void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface &surface, uint16 *zbufferLine) {
 	if (slice < 0 || (uint32)slice >= _frameSliceCount) {
 		return;
@@ -553,6 +603,8 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 	uint32 polyCount = READ_LE_UINT32(p);
 	p += 4;
 
+	byte *linePtr = (byte *)surface.getBasePtr(0, CLIP(y, 0, surface.h - 1));
+
 	while (polyCount--) {
 		uint32 vertexCount = READ_LE_UINT32(p);
 		p += 4;
@@ -586,11 +638,28 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 						outColor = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
 					}
 
-					for (int x = previousVertexX; x != vertexX; ++x) {
+					int spanEnd = MIN<int>(vertexX, surface.w);
+					if (previousVertexX < spanEnd) {
+						int count = spanEnd - previousVertexX;
+						switch (surface.format.bytesPerPixel) {
+						case 1:
+							drawSpan((uint8 *)linePtr + previousVertexX, zbufferLine + previousVertexX, count, vertexZ, outColor);
+							break;
+						case 2:
+							drawSpan((uint16 *)linePtr + previousVertexX, zbufferLine + previousVertexX, count, vertexZ, outColor);
+							break;
+						case 4:
+							drawSpan((uint32 *)linePtr + previousVertexX, zbufferLine + previousVertexX, count, vertexZ, outColor);
+							break;
+						}
+					}
+
+					// Whatever is right of a narrower surface ends up in its last column
+					for (int x = MAX(previousVertexX, spanEnd); x < vertexX; ++x) {
 						if (vertexZ < zbufferLine[x]) {
 							zbufferLine[x] = (uint16)vertexZ;
 
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
+							void *dstPtr = surface.getBasePtr(surface.w - 1, CLIP(y, 0, surface.h - 1));
 							drawPixel(surface, dstPtr, outColor);
 						}
 					}
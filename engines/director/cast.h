@@ -56,8 +56,6 @@ public:
 	Common::Rect boundingRect;
 	Common::Array<Resource> children;
 
-	const Graphics::Surface *surface;
-
 	byte modified;
 };
 
@@ -28,9 +28,11 @@
 #include "graphics/fonts/macfont.h"
 
 #include "graphics/macgui/macwindowmanager.h"
+#include "image/image_decoder.h"
 
 #include "director/director.h"
 #include "director/archive.h"
+#include "director/score.h"
 #include "director/sound.h"
 #include "director/lingo/lingo.h"
 
@@ -93,6 +95,8 @@ DirectorEngine::DirectorEngine(OSystem *syst, const DirectorGameDescription *gam
 
 	_draggingSprite = false;
 	_draggingSpriteId = 0;
+
+	_bitmapCacheSize = 0;
 }
 
 DirectorEngine::~DirectorEngine() {
@@ -266,4 +270,105 @@ Common::HashMap<int, CastType> *DirectorEngine::getSharedCastTypes() {
 	return &_dummyCastType;
 }
 
+CachedBitmap *DirectorEngine::getCachedBitmap(uint16 castId, const BitmapCast *bitmapCast) {
+	// Sprites may use members of the shared cast as well as of the movie's own
+	Score *score = _currentScore;
+	if (_sharedScore && _sharedScore->_loadedBitmaps->getVal(castId, nullptr) == bitmapCast)
+		score = _sharedScore;
+
+	BitmapCacheKey key;
+	key.score = score;
+	key.castId = castId;
+
+	BitmapCacheIndex::iterator pos = _bitmapCacheIndex.find(key);
+	if (pos != _bitmapCacheIndex.end()) {
+		if (pos->_value != _bitmapCache.begin()) {
+			_bitmapCache.push_front(*pos->_value);
+			_bitmapCache.erase(pos->_value);
+			pos->_value = _bitmapCache.begin();
+		}
+		return _bitmapCache.front().decoder ? &_bitmapCache.front() : nullptr;
+	}
+
+	CachedBitmap bitmap;
+	bitmap.score = score;
+	bitmap.castId = castId;
+	bitmap.decoder = score->loadSpriteImage(castId);
+	bitmap.matte = nullptr;
+	bitmap.matteColor = -1;
+	bitmap.size = 0;
+
+	// A failed image stays in the cache too, so it isn't decoded again on
+	// every frame
+	const Graphics::Surface *surface = bitmap.decoder ? bitmap.decoder->getSurface() : nullptr;
+	if (surface) {
+		bitmap.size = surface->pitch * surface->h;
+	} else {
+		warning("No image for cast %d", castId);
+		delete bitmap.decoder;
+		bitmap.decoder = nullptr;
+	}
+
+	_bitmapCache.push_front(bitmap);
+	_bitmapCacheIndex[key] = _bitmapCache.begin();
+	_bitmapCacheSize += bitmap.size;
+
+	// Never evict the image just decoded, the caller is about to draw it
+	while (_bitmapCacheSize > BITMAP_CACHE_SIZE && _bitmapCache.size() > 1) {
+		CachedBitmap &last = _bitmapCache.back();
+		debugC(5, kDebugImages, "Evicting decoded image of cast %d", last.castId);
+
+		BitmapCacheKey lastKey;
+		lastKey.score = last.score;
+		lastKey.castId = last.castId;
+		_bitmapCacheIndex.erase(lastKey);
+
+		freeCachedBitmap(last);
+		_bitmapCache.pop_back();
+	}
+
+	return bitmap.decoder ? &_bitmapCache.front() : nullptr;
+}
+
+void DirectorEngine::purgeBitmapCache(const Score *score) {
+	Common::List<CachedBitmap>::iterator it = _bitmapCache.begin();
+	while (it != _bitmapCache.end()) {
+		if (it->score == score) {
+			BitmapCacheKey key;
+			key.score = it->score;
+			key.castId = it->castId;
+			_bitmapCacheIndex.erase(key);
+
+			freeCachedBitmap(*it);
+			it = _bitmapCache.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+void DirectorEngine::freeCachedBitmap(CachedBitmap &bitmap) {
+	_bitmapCacheSize -= bitmap.size;
+	delete bitmap.decoder;
+	if (bitmap.matte) {
+		bitmap.matte->free();
+		delete bitmap.matte;
+	}
+}
+
+void DirectorEngine::setBitmapMatte(CachedBitmap *bitmap, byte whiteColor, Graphics::Surface *matte) {
+	if (bitmap->matte) {
+		_bitmapCacheSize -= bitmap->matte->pitch * bitmap->matte->h;
+		bitmap->size -= bitmap->matte->pitch * bitmap->matte->h;
+		bitmap->matte->free();
+		delete bitmap->matte;
+	}
+
+	// The mask is charged to the image, and goes away along with it
+	bitmap->matte = matte;
+	bitmap->matteColor = whiteColor;
+	bitmap->size += matte->pitch * matte->h;
+	_bitmapCacheSize += matte->pitch * matte->h;
+}
+
 } // End of namespace Director
@@ -27,11 +27,16 @@
 #include "common/substream.h"
 
 #include "common/hashmap.h"
+#include "common/hash-ptr.h"
+#include "common/list.h"
 #include "engines/engine.h"
 #include "director/cast.h"
 
 #define CHANNEL_COUNT 30
 
+// Memory for decoded cast member images
+#define BITMAP_CACHE_SIZE (16 * 1024 * 1024)
+
 namespace Common {
 class MacResManager;
 }
@@ -41,6 +46,10 @@ class MacWindowManager;
 typedef Common::Array<byte *> MacPatterns;
 }
 
+namespace Image {
+class ImageDecoder;
+}
+
 namespace Director {
 
 enum DirectorGameID {
@@ -75,6 +84,19 @@ struct MovieReference {
 
 extern byte defaultPalette[768];
 
+/**
+ * A decoded cast member image, along with its matte mask once the sprite
+ * has been drawn with the matte ink.
+ */
+struct CachedBitmap {
+	const Score *score;
+	uint16 castId;
+	Image::ImageDecoder *decoder; ///< nullptr if the image couldn't be loaded
+	Graphics::Surface *matte;     ///< Flood-filled mask for the matte ink, if drawn with it
+	int matteColor;
+	uint32 size;
+};
+
 class DirectorEngine : public ::Engine {
 public:
 	DirectorEngine(OSystem *syst, const DirectorGameDescription *gameDesc);
@@ -114,6 +136,23 @@ public:
 	Common::HashMap<int, Common::SeekableSubReadStreamEndian *> *getSharedSTXT() const { return _sharedSTXT; }
 	Common::HashMap<int, CastType> *getSharedCastTypes();
 
+	/**
+	 * Returns the image of a bitmap cast member of the current movie or the
+	 * shared cast, decoding it on first use. Decoded images are kept within
+	 * a memory budget, dropping the least recently used ones first.
+	 * @return the cached image, or nullptr if it can't be loaded
+	 */
+	CachedBitmap *getCachedBitmap(uint16 castId, const BitmapCast *bitmapCast);
+	/**
+	 * Drops the decoded images of a score's cast, when the score goes away.
+	 */
+	void purgeBitmapCache(const Score *score);
+	/**
+	 * Attaches a matte mask to a cached image, replacing the one it had.
+	 * The cache takes ownership of the mask.
+	 */
+	void setBitmapMatte(CachedBitmap *bitmap, byte whiteColor, Graphics::Surface *matte);
+
 	Common::HashMap<Common::String, Score *> *_movies;
 
 	Common::RandomSource _rnd;
@@ -166,6 +205,26 @@ private:
 	Common::String _sharedCastFile;
 	Common::HashMap<int, CastType> _dummyCastType;
 
+	struct BitmapCacheKey {
+		const Score *score;
+		uint16 castId;
+
+		bool operator==(const BitmapCacheKey &other) const {
+			return score == other.score && castId == other.castId;
+		}
+	};
+	struct BitmapCacheKeyHash : public Common::UnaryFunction<BitmapCacheKey, uint> {
+		uint operator()(const BitmapCacheKey &key) const {
+			return Common::Hash<const Score *>()(key.score) ^ key.castId;
+		}
+	};
+	typedef Common::HashMap<BitmapCacheKey, Common::List<CachedBitmap>::iterator, BitmapCacheKeyHash> BitmapCacheIndex;
+
+	void freeCachedBitmap(CachedBitmap &bitmap);
+	Common::List<CachedBitmap> _bitmapCache; ///< Most recently used first
+	BitmapCacheIndex _bitmapCacheIndex;      ///< Position of each image in _bitmapCache
+	uint32 _bitmapCacheSize;
+
 	bool _draggingSprite;
 	uint16 _draggingSpriteId;
 	Common::Point _draggingSpritePos;
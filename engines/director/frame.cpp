@@ -59,6 +59,7 @@ Frame::Frame(DirectorEngine *vm) {
 	_blend = 0;
 
 	_palette = NULL;
+	_measuring = false;
 
 	_sprites.resize(CHANNEL_COUNT + 1);
 
@@ -83,6 +84,7 @@ Frame::Frame(const Frame &frame) {
 	_skipFrameFlag = frame._skipFrameFlag;
 	_blend = frame._blend;
 	_palette = new PaletteInfo();
+	_measuring = false;
 
 	debugC(1, kDebugLoading, "Frame. action: %d transType: %d transDuration: %d", _actionId, _transType, _transDuration);
 
@@ -403,19 +405,75 @@ void Frame::readSprite(Common::SeekableSubReadStreamEndian &stream, uint16 offse
 }
 
 void Frame::prepareFrame(Score *score) {
+	Graphics::ManagedSurface &stage = *score->_surface;
+
+	// The stage keeps the previous frame, only the area where sprites
+	// changed is composited again from the trails up
+	Common::Rect changedArea = getChangedArea(score);
+
 	_drawRects.clear();
-	renderSprites(*score->_surface, false);
-	renderSprites(*score->_trailSurface, true);
+	_clipRect = changedArea;
+	if (!changedArea.isEmpty())
+		stage.blitFrom(*score->_trailSurface, changedArea, Common::Point(changedArea.left, changedArea.top));
+	renderSprites(score, stage, false);
 
-	if (_transType != 0)
+	_clipRect = Common::Rect(score->_trailSurface->w, score->_trailSurface->h);
+	renderSprites(score, *score->_trailSurface, true);
+
+	if (_transType != 0) {
 		// TODO Handle changing area case
 		playTransition(score);
+		changedArea = Common::Rect(stage.w, stage.h);
+	}
 
 	if (_sound1 != 0 || _sound2 != 0) {
 		playSoundChannel();
 	}
 
-	g_system->copyRectToScreen(score->_surface->getPixels(), score->_surface->pitch, 0, 0, score->_surface->getBounds().width(), score->_surface->getBounds().height());
+	if (!changedArea.isEmpty())
+		g_system->copyRectToScreen(stage.getBasePtr(changedArea.left, changedArea.top), stage.pitch, changedArea.left, changedArea.top, changedArea.width(), changedArea.height());
+}
+
+static void extendArea(Common::Rect &area, const Common::Rect &rect) {
+	if (area.isEmpty())
+		area = rect;
+	else if (!rect.isEmpty())
+		area.extend(rect);
+}
+
+Common::Rect Frame::getChangedArea(Score *score) {
+	Common::Rect stageRect(score->_surface->w, score->_surface->h);
+
+	// Trails drawn during the previous frame show from this one on
+	Common::Rect area = score->_trailDamage;
+	score->_trailDamage = Common::Rect();
+
+	if (score->_fullRedraw) {
+		score->_fullRedraw = false;
+		return stageRect;
+	}
+
+	for (uint16 i = 0; i < CHANNEL_COUNT; i++) {
+		if (score->_channelStates[i].matches(*_sprites[i], score->_currentMouseDownSpriteId == i))
+			continue;
+
+		// The sprite is erased from where it was, and drawn where it goes
+		extendArea(area, score->_channelStates[i].bounds);
+		if (_sprites[i]->_enabled && _sprites[i]->_trails != 1)
+			extendArea(area, measureSprite(score, i));
+	}
+
+	area.clip(stageRect);
+	return area;
+}
+
+Common::Rect Frame::measureSprite(Score *score, uint16 spriteId) {
+	_measuring = true;
+	_spriteBounds = Common::Rect();
+	renderSprite(*score->_surface, spriteId);
+	_measuring = false;
+
+	return _spriteBounds;
 }
 
 void Frame::playSoundChannel() {
@@ -566,75 +624,120 @@ void Frame::playTransition(Score *score) {
 	}
 }
 
-void Frame::renderSprites(Graphics::ManagedSurface &surface, bool renderTrail) {
+void Frame::renderSprites(Score *score, Graphics::ManagedSurface &surface, bool renderTrail) {
 	for (uint16 i = 0; i < CHANNEL_COUNT; i++) {
-		if (_sprites[i]->_enabled) {
-			if ((_sprites[i]->_trails == 0 && renderTrail) || (_sprites[i]->_trails == 1 && !renderTrail))
-				continue;
-
-			CastType castType = kCastTypeNull;
-			if (_vm->getVersion() < 4) {
-				debugC(1, kDebugImages, "Channel: %d type: %d", i, _sprites[i]->_spriteType);
-				switch (_sprites[i]->_spriteType) {
-				case 1:
-					castType = kCastBitmap;
-					break;
-				case 2:
-				case 12: // this is actually a mouse-over shape? I don't think it's a real button.
-				case 16: // Face kit D3
-					castType = kCastShape;
-					break;
-				case 7:
-					castType = kCastText;
-					break;
-				}
-			} else {
-				if (!_vm->getCurrentScore()->_castTypes.contains(_sprites[i]->_castId)) {
-					if (!_vm->getSharedCastTypes()->contains(_sprites[i]->_castId)) {
-						warning("Cast id %d not found", _sprites[i]->_castId);
-						continue;
-					} else {
-						warning("Getting cast id %d from shared cast", _sprites[i]->_castId);
-						castType = _vm->getSharedCastTypes()->getVal(_sprites[i]->_castId);
-					}
-				} else {
-					castType = _vm->getCurrentScore()->_castTypes[_sprites[i]->_castId];
-				}
+		bool drawn = _sprites[i]->_enabled;
+		if ((_sprites[i]->_trails == 0 && renderTrail) || (_sprites[i]->_trails == 1 && !renderTrail))
+			drawn = false;
+
+		if (renderTrail) {
+			if (drawn) {
+				_spriteBounds = Common::Rect();
+				renderSprite(surface, i);
+				extendArea(score->_trailDamage, _spriteBounds);
 			}
+			continue;
+		}
 
-			// this needs precedence to be hit first... D3 does something really tricky with cast IDs for shapes.
-			// I don't like this implementation 100% as the 'cast' above might not actually hit a member and be null?
-			if (castType == kCastShape) {
-				renderShape(surface, i);
-			} else if (castType == kCastText || castType == kCastRTE) {
-				renderText(surface, i, NULL);
-			} else if (castType == kCastButton) {
-				renderButton(surface, i);
-			} else {
-				if (!_sprites[i]->_bitmapCast) {
-					warning("No cast ID for sprite %d", i);
-					continue;
-				}
+		ChannelState &state = score->_channelStates[i];
+		bool highlighted = score->_currentMouseDownSpriteId == i;
 
-				uint32 regX = _sprites[i]->_bitmapCast->regX;
-				uint32 regY = _sprites[i]->_bitmapCast->regY;
-				uint32 rectLeft = _sprites[i]->_bitmapCast->initialRect.left;
-				uint32 rectTop = _sprites[i]->_bitmapCast->initialRect.top;
+		if (!drawn) {
+			state.update(*_sprites[i], highlighted);
+			state.bounds = Common::Rect();
+			state.drawRects.clear();
+			continue;
+		}
 
-				int x = _sprites[i]->_startPoint.x - regX + rectLeft;
-				int y = _sprites[i]->_startPoint.y - regY + rectTop;
-				int height = _sprites[i]->_height;
-				int width = _vm->getVersion() > 4 ? _sprites[i]->_bitmapCast->initialRect.width() : _sprites[i]->_width;
+		// Sprites away from the changed area are already on the stage
+		if (state.matches(*_sprites[i], highlighted) && !state.bounds.intersects(_clipRect)) {
+			for (uint r = 0; r < state.drawRects.size(); r++)
+				addDrawRect(i, state.drawRects[r]);
+			continue;
+		}
 
-				Common::Rect drawRect(x, y, x + width, y + height);
-				addDrawRect(i, drawRect);
-				inkBasedBlit(surface, *(_sprites[i]->_bitmapCast->surface), i, drawRect);
+		uint firstDrawRect = _drawRects.size();
+		_spriteBounds = Common::Rect();
+		renderSprite(surface, i);
+
+		state.update(*_sprites[i], highlighted);
+		state.bounds = _spriteBounds;
+		state.drawRects.clear();
+		for (uint r = firstDrawRect; r < _drawRects.size(); r++)
+			state.drawRects.push_back(_drawRects[r]->rect);
+	}
+}
+
+void Frame::renderSprite(Graphics::ManagedSurface &surface, uint16 spriteId) {
+	CastType castType = kCastTypeNull;
+	if (_vm->getVersion() < 4) {
+		debugC(1, kDebugImages, "Channel: %d type: %d", spriteId, _sprites[spriteId]->_spriteType);
+		switch (_sprites[spriteId]->_spriteType) {
+		case 1:
+			castType = kCastBitmap;
+			break;
+		case 2:
+		case 12: // this is actually a mouse-over shape? I don't think it's a real button.
+		case 16: // Face kit D3
+			castType = kCastShape;
+			break;
+		case 7:
+			castType = kCastText;
+			break;
+		}
+	} else {
+		if (!_vm->getCurrentScore()->_castTypes.contains(_sprites[spriteId]->_castId)) {
+			if (!_vm->getSharedCastTypes()->contains(_sprites[spriteId]->_castId)) {
+				warning("Cast id %d not found", _sprites[spriteId]->_castId);
+				return;
+			} else {
+				warning("Getting cast id %d from shared cast", _sprites[spriteId]->_castId);
+				castType = _vm->getSharedCastTypes()->getVal(_sprites[spriteId]->_castId);
 			}
+		} else {
+			castType = _vm->getCurrentScore()->_castTypes[_sprites[spriteId]->_castId];
+		}
+	}
+
+	// this needs precedence to be hit first... D3 does something really tricky with cast IDs for shapes.
+	// I don't like this implementation 100% as the 'cast' above might not actually hit a member and be null?
+	if (castType == kCastShape) {
+		renderShape(surface, spriteId);
+	} else if (castType == kCastText || castType == kCastRTE) {
+		renderText(surface, spriteId, NULL);
+	} else if (castType == kCastButton) {
+		renderButton(surface, spriteId);
+	} else {
+		if (!_sprites[spriteId]->_bitmapCast) {
+			warning("No cast ID for sprite %d", spriteId);
+			return;
 		}
+
+		uint32 regX = _sprites[spriteId]->_bitmapCast->regX;
+		uint32 regY = _sprites[spriteId]->_bitmapCast->regY;
+		uint32 rectLeft = _sprites[spriteId]->_bitmapCast->initialRect.left;
+		uint32 rectTop = _sprites[spriteId]->_bitmapCast->initialRect.top;
+
+		int x = _sprites[spriteId]->_startPoint.x - regX + rectLeft;
+		int y = _sprites[spriteId]->_startPoint.y - regY + rectTop;
+		int height = _sprites[spriteId]->_height;
+		int width = _vm->getVersion() > 4 ? _sprites[spriteId]->_bitmapCast->initialRect.width() : _sprites[spriteId]->_width;
+
+		// Images which failed to decode were already warned about
+		CachedBitmap *bitmap = _vm->getCachedBitmap(_sprites[spriteId]->_castId, _sprites[spriteId]->_bitmapCast);
+		if (!bitmap)
+			return;
+
+		Common::Rect drawRect(x, y, x + width, y + height);
+		addDrawRect(spriteId, drawRect);
+		inkBasedBlit(surface, *bitmap->decoder->getSurface(), spriteId, drawRect, bitmap);
 	}
 }
 
 void Frame::addDrawRect(uint16 spriteId, Common::Rect &rect) {
+	if (_measuring)
+		return;
+
 	FrameEntity *fi = new FrameEntity();
 	fi->spriteId = spriteId;
 	fi->rect = rect;
@@ -695,51 +798,81 @@ void Frame::renderButton(Graphics::ManagedSurface &surface, uint16 spriteId) {
 	case kTypeCheckBox:
 		// Magic numbers: checkbox square need to move left about 5px from text and 12px side size (D4)
 		_rect = Common::Rect(x - 17, y, x + 12, y + 12);
-		surface.frameRect(_rect, 0);
-		addDrawRect(spriteId, _rect);
 		break;
-	case kTypeButton: {
-			_rect = Common::Rect(x, y, x + width, y + height + 3);
-			Graphics::MacPlotData pd(&surface, &_vm->getMacWindowManager()->getPatterns(), Graphics::MacGUIConstants::kPatternSolid, 1, Graphics::kColorWhite);
-			Graphics::drawRoundRect(_rect, 4, 0, false, Graphics::macDrawPixel, &pd);
-			addDrawRect(spriteId, _rect);
-		}
+	case kTypeButton:
+		_rect = Common::Rect(x, y, x + width, y + height + 3);
 		break;
 	case kTypeRadio:
 		warning("STUB: renderButton: kTypeRadio");
-		break;
+		return;
+	}
+
+	addDrawRect(spriteId, _rect);
+	extendArea(_spriteBounds, _rect);
+
+	if (_measuring || !_rect.intersects(_clipRect))
+		return;
+
+	// Drawn in a view of the clip rect, so the outline doesn't spill out of it
+	Graphics::ManagedSurface clipped(surface, _clipRect);
+	Common::Rect frameRect(_rect);
+	frameRect.translate(-_clipRect.left, -_clipRect.top);
+
+	if (button->buttonType == kTypeCheckBox) {
+		clipped.frameRect(frameRect, 0);
+	} else {
+		Graphics::MacPlotData pd(&clipped, &_vm->getMacWindowManager()->getPatterns(), Graphics::MacGUIConstants::kPatternSolid, 1, Graphics::kColorWhite);
+		Graphics::drawRoundRect(frameRect, 4, 0, false, Graphics::macDrawPixel, &pd);
 	}
 }
 
-void Frame::inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics::Surface &spriteSurface, uint16 spriteId, Common::Rect drawRect) {
-	switch (_sprites[spriteId]->_ink) {
+void Frame::inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics::Surface &spriteSurface, uint16 spriteId, Common::Rect drawRect, CachedBitmap *bitmap) {
+	InkType ink = _sprites[spriteId]->_ink;
+
+	// The plain blits draw the whole sprite surface, the other inks only
+	// as much of its rows as the sprite is wide
+	Common::Rect blitRect(drawRect.left, drawRect.top, drawRect.left + spriteSurface.w, drawRect.top + spriteSurface.h);
+	if (ink == kInkTypeBackgndTrans || ink == kInkTypeMatte || ink == kInkTypeGhost || ink == kInkTypeReverse)
+		blitRect.right = MIN<int>(blitRect.right, drawRect.right);
+
+	extendArea(_spriteBounds, blitRect);
+
+	if (_measuring || !blitRect.intersects(_clipRect))
+		return;
+
+	Common::Rect clipRect(blitRect);
+	clipRect.clip(_clipRect);
+
+	Common::Point srcPos(clipRect.left - blitRect.left, clipRect.top - blitRect.top);
+	Common::Rect srcRect(srcPos.x, srcPos.y, srcPos.x + clipRect.width(), srcPos.y + clipRect.height());
+
+	switch (ink) {
 	case kInkTypeCopy:
-		targetSurface.blitFrom(spriteSurface, Common::Point(drawRect.left, drawRect.top));
+		targetSurface.blitFrom(spriteSurface, srcRect, Common::Point(clipRect.left, clipRect.top));
 		break;
 	case kInkTypeTransparent:
 		// FIXME: is it always white (last entry in pallette)?
-		targetSurface.transBlitFrom(spriteSurface, Common::Point(drawRect.left, drawRect.top), _vm->getPaletteColorCount() - 1);
+		targetSurface.transBlitFrom(spriteSurface, srcRect, Common::Point(clipRect.left, clipRect.top), _vm->getPaletteColorCount() - 1);
 		break;
 	case kInkTypeBackgndTrans:
-		drawBackgndTransSprite(targetSurface, spriteSurface, drawRect);
+		drawBackgndTransSprite(targetSurface, spriteSurface, srcPos, clipRect);
 		break;
 	case kInkTypeMatte:
-		drawMatteSprite(targetSurface, spriteSurface, drawRect);
+		drawMatteSprite(targetSurface, spriteSurface, srcPos, clipRect, bitmap);
 		break;
 	case kInkTypeGhost:
-		drawGhostSprite(targetSurface, spriteSurface, drawRect);
+		drawGhostSprite(targetSurface, spriteSurface, srcPos, clipRect);
 		break;
 	case kInkTypeReverse:
-		drawReverseSprite(targetSurface, spriteSurface, drawRect);
+		drawReverseSprite(targetSurface, spriteSurface, srcPos, clipRect);
 		break;
 	default:
-		warning("Unhandled ink type %d", _sprites[spriteId]->_ink);
-		targetSurface.blitFrom(spriteSurface, Common::Point(drawRect.left, drawRect.top));
+		warning("Unhandled ink type %d", ink);
+		targetSurface.blitFrom(spriteSurface, srcRect, Common::Point(clipRect.left, clipRect.top));
 		break;
 	}
 }
 
-
 void Frame::renderText(Graphics::ManagedSurface &surface, uint16 spriteId, Common::Rect *textSize) {
 	TextCast *textCast = _sprites[spriteId]->_buttonCast != nullptr ? (TextCast*)_sprites[spriteId]->_buttonCast : _sprites[spriteId]->_textCast;
 
@@ -861,14 +994,31 @@ void Frame::renderText(Graphics::ManagedSurface &surface, uint16 spriteId, Commo
 	inkBasedBlit(surface, textWithFeatures, spriteId, Common::Rect(x, y, x + width, y + height));
 }
 
-void Frame::drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
+void Frame::drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, const Common::Point &srcPos, const Common::Rect &drawRect) {
 	uint8 skipColor = _vm->getPaletteColorCount() - 1; // FIXME is it always white (last entry in pallette) ?
+	const uint32 skipWord = skipColor * 0x01010101u;
 
-	for (int ii = 0; ii < sprite.h; ii++) {
-		const byte *src = (const byte *)sprite.getBasePtr(0, ii);
+	for (int ii = 0; ii < drawRect.height(); ii++) {
+		const byte *src = (const byte *)sprite.getBasePtr(srcPos.x, srcPos.y + ii);
 		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + ii);
+		int j = 0;
 
-		for (int j = 0; j < drawRect.width(); j++) {
+		// Copy four pixels at once, unless one of them is the transparent color
+		for (; j + 4 <= drawRect.width(); j += 4, src += 4, dst += 4) {
+			uint32 word;
+			memcpy(&word, src, 4);
+
+			uint32 diff = word ^ skipWord;
+			if (((diff - 0x01010101u) & ~diff & 0x80808080) == 0) {
+				memcpy(dst, src, 4);
+			} else {
+				for (int k = 0; k < 4; k++)
+					if (src[k] != skipColor)
+						dst[k] = src[k];
+			}
+		}
+
+		for (; j < drawRect.width(); j++) {
 			if (*src != skipColor)
 				*dst = *src;
 
@@ -878,30 +1028,69 @@ void Frame::drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graph
 	}
 }
 
-void Frame::drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
+void Frame::getSpriteCoverage(int y, int left, int width) {
+	// Same as calling getSpriteIDFromPos() on every pixel of the row, but
+	// walks the draw rects once instead of once per pixel
+	_spriteCoverage.resize(width);
+	memset(_spriteCoverage.begin(), 0xff, width);
+
+	int undecided = width;
+
+	for (int dr = _drawRects.size() - 1; dr >= 0 && undecided > 0; dr--) {
+		const Common::Rect &rect = _drawRects[dr]->rect;
+		if (y < rect.top || y >= rect.bottom)
+			continue;
+
+		int x1 = MAX<int>(rect.left, left) - left;
+		int x2 = MIN<int>(rect.right, left + width) - left;
+		byte covered = _drawRects[dr]->spriteId != 0;
+
+		for (int x = x1; x < x2; x++) {
+			if (_spriteCoverage[x] == 0xff) {
+				_spriteCoverage[x] = covered;
+				undecided--;
+			}
+		}
+	}
+
+	if (undecided > 0) {
+		for (int x = 0; x < width; x++)
+			if (_spriteCoverage[x] == 0xff)
+				_spriteCoverage[x] = 0;
+	}
+}
+
+void Frame::drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, const Common::Point &srcPos, const Common::Rect &drawRect) {
 	uint8 skipColor = _vm->getPaletteColorCount() - 1;
-	for (int ii = 0; ii < sprite.h; ii++) {
-		const byte *src = (const byte *)sprite.getBasePtr(0, ii);
+	for (int ii = 0; ii < drawRect.height(); ii++) {
+		const byte *src = (const byte *)sprite.getBasePtr(srcPos.x, srcPos.y + ii);
 		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + ii);
 
+		getSpriteCoverage(drawRect.top + ii, drawRect.left, drawRect.width());
+		const byte *covered = _spriteCoverage.begin();
+
 		for (int j = 0; j < drawRect.width(); j++) {
-			if ((getSpriteIDFromPos(Common::Point(drawRect.left + j, drawRect.top + ii)) != 0) && (*src != skipColor))
-				*dst = (_vm->getPaletteColorCount() - 1) - *src; // Oposite color
+			if (*covered && (*src != skipColor))
+				*dst = skipColor - *src; // Oposite color
 
 			src++;
 			dst++;
+			covered++;
 		}
 	}
 }
 
-void Frame::drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
+void Frame::drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, const Common::Point &srcPos, const Common::Rect &drawRect) {
 	uint8 skipColor = _vm->getPaletteColorCount() - 1;
-	for (int ii = 0; ii < sprite.h; ii++) {
-		const byte *src = (const byte *)sprite.getBasePtr(0, ii);
+	for (int ii = 0; ii < drawRect.height(); ii++) {
+		const byte *src = (const byte *)sprite.getBasePtr(srcPos.x, srcPos.y + ii);
 		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + ii);
 
+		getSpriteCoverage(drawRect.top + ii, drawRect.left, drawRect.width());
+		const byte *covered = _spriteCoverage.begin();
+
 		for (int j = 0; j < drawRect.width(); j++) {
-			if ((getSpriteIDFromPos(Common::Point(drawRect.left + j, drawRect.top + ii)) != 0)) {
+			if (*covered) {
 				if (*src != skipColor) {
 					*dst = (*dst == *src ? (*src == 0 ? 0xff : 0) : *src);
 				}
@@ -910,23 +1099,22 @@ void Frame::drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::
 			}
 			src++;
 			dst++;
+			covered++;
 		}
 	}
 }
 
-void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
+void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, const Common::Point &srcPos, const Common::Rect &drawRect, CachedBitmap *bitmap) {
 	// Like background trans, but all white pixels NOT ENCLOSED by coloured pixels are transparent
-	Graphics::Surface tmp;
-	tmp.copyFrom(sprite);
 
 	// Searching white color in the corners
 	int whiteColor = -1;
 
 	for (int corner = 0; corner < 4; corner++) {
-		int x = (corner & 0x1) ? tmp.w - 1 : 0;
-		int y = (corner & 0x2) ? tmp.h - 1 : 0;
+		int x = (corner & 0x1) ? sprite.w - 1 : 0;
+		int y = (corner & 0x2) ? sprite.h - 1 : 0;
 
-		byte color = *(byte *)tmp.getBasePtr(x, y);
+		byte color = *(const byte *)sprite.getBasePtr(x, y);
 
 		if (_vm->getPalette()[color * 3 + 0] == 0xff &&
 			_vm->getPalette()[color * 3 + 1] == 0xff &&
@@ -939,14 +1127,27 @@ void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Su
 	if (whiteColor == -1) {
 		debugC(1, kDebugImages, "No white color for Matte image");
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			const byte *src = (const byte *)tmp.getBasePtr(0, yy);
+		for (int yy = 0; yy < drawRect.height(); yy++) {
+			const byte *src = (const byte *)sprite.getBasePtr(srcPos.x, srcPos.y + yy);
 			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
 
-			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++)
-				*dst = *src;
+			memcpy(dst, src, drawRect.width());
 		}
-	} else {
+		return;
+	}
+
+	// The mask only depends on the image, so bitmap cast members keep theirs
+	// and it is only flood-filled the first time they are drawn
+	const Graphics::Surface *matte = nullptr;
+	Graphics::Surface *newMatte = nullptr;
+
+	if (bitmap && bitmap->matteColor == whiteColor)
+		matte = bitmap->matte;
+
+	if (!matte) {
+		Graphics::Surface tmp;
+		tmp.copyFrom(sprite);
+
 		Graphics::FloodFill ff(&tmp, whiteColor, 0, true);
 
 		for (int yy = 0; yy < tmp.h; yy++) {
@@ -960,18 +1161,32 @@ void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Su
 		}
 		ff.fillMask();
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			const byte *src = (const byte *)tmp.getBasePtr(0, yy);
-			const byte *mask = (const byte *)ff.getMask()->getBasePtr(0, yy);
-			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
+		newMatte = new Graphics::Surface();
+		newMatte->copyFrom(*ff.getMask());
+		matte = newMatte;
 
-			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++, mask++)
-				if (*mask == 0)
-					*dst = *src;
-		}
+		tmp.free();
 	}
 
-	tmp.free();
+	for (int yy = 0; yy < drawRect.height(); yy++) {
+		const byte *src = (const byte *)sprite.getBasePtr(srcPos.x, srcPos.y + yy);
+		const byte *mask = (const byte *)matte->getBasePtr(srcPos.x, srcPos.y + yy);
+		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
+
+		for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++, mask++)
+			if (*mask == 0)
+				*dst = *src;
+	}
+
+	if (newMatte) {
+		// Text and shapes are rendered anew each frame, their masks can't be kept
+		if (bitmap) {
+			_vm->setBitmapMatte(bitmap, whiteColor, newMatte);
+		} else {
+			newMatte->free();
+			delete newMatte;
+		}
+	}
 }
 
 uint16 Frame::getSpriteIDFromPos(Common::Point pos) {
@@ -31,6 +31,7 @@ namespace Image {
 
 namespace Director {
 
+struct CachedBitmap;
 class Sprite;
 
 enum {
@@ -124,7 +125,10 @@ public:
 private:
 	void playTransition(Score *score);
 	void playSoundChannel();
-	void renderSprites(Graphics::ManagedSurface &surface, bool renderTrail);
+	Common::Rect getChangedArea(Score *score);
+	Common::Rect measureSprite(Score *score, uint16 spriteId);
+	void renderSprites(Score *score, Graphics::ManagedSurface &surface, bool renderTrail);
+	void renderSprite(Graphics::ManagedSurface &surface, uint16 spriteId);
 	void renderText(Graphics::ManagedSurface &surface, uint16 spriteId, Common::Rect *textSize);
 	void renderShape(Graphics::ManagedSurface &surface, uint16 spriteId);
 	void renderButton(Graphics::ManagedSurface &surface, uint16 spriteId);
@@ -133,11 +137,12 @@ private:
 	void readMainChannels(Common::SeekableSubReadStreamEndian &stream, uint16 offset, uint16 size);
 	Image::ImageDecoder *getImageFrom(uint16 spriteId);
 	Common::String readTextStream(Common::SeekableSubReadStreamEndian *textStream, TextCast *textCast);
-	void drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
-	void drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
-	void drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
-	void drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect);
-	void inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics::Surface &spriteSurface, uint16 spriteId, Common::Rect drawRect);
+	void drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, const Common::Point &srcPos, const Common::Rect &drawRect);
+	void drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, const Common::Point &srcPos, const Common::Rect &drawRect, CachedBitmap *bitmap);
+	void drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, const Common::Point &srcPos, const Common::Rect &drawRect);
+	void drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, const Common::Point &srcPos, const Common::Rect &drawRect);
+	void getSpriteCoverage(int y, int left, int width);
+	void inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics::Surface &spriteSurface, uint16 spriteId, Common::Rect drawRect, CachedBitmap *bitmap = nullptr);
 	void addDrawRect(uint16 entityId, Common::Rect &rect);
 
 public:
@@ -159,6 +164,10 @@ public:
 	uint8 _blend;
 	Common::Array<Sprite *> _sprites;
 	Common::Array<FrameEntity *> _drawRects;
+	Common::Array<byte> _spriteCoverage; ///< Scratch row for getSpriteCoverage()
+	Common::Rect _clipRect;     ///< Part of the target surface sprites are drawn into
+	Common::Rect _spriteBounds; ///< Area painted by the sprite being drawn
+	bool _measuring;            ///< Only record _spriteBounds, don't draw
 	DirectorEngine *_vm;
 };
 
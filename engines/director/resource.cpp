@@ -333,8 +333,6 @@ void DirectorEngine::loadSharedCastsFrom(Common::String filename) {
 			_sharedSound->setVal(*iterator, shardcst->getResource(MKTAG('S','N','D',' '), *iterator));
 		}
 	}
-
-	_sharedScore->loadSpriteImages(true);
 }
 
 } // End of namespace Director
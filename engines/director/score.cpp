@@ -67,6 +67,7 @@ Score::Score(DirectorEngine *vm) {
 	_lingo = _vm->getLingo();
 	_soundManager = _vm->getSoundManager();
 	_currentMouseDownSpriteId = 0;
+	_fullRedraw = true;
 
 	// FIXME: TODO: Check whether the original truely does it
 	if (_vm->getVersion() <= 3) {
@@ -178,7 +179,6 @@ void Score::loadArchive() {
 	}
 
 	setSpriteCasts();
-	loadSpriteImages(false);
 
 	// Try to load movie script, it sits in resource A11
 	if (_vm->getVersion() <= 3) {
@@ -213,74 +213,83 @@ void Score::copyCastStxts() {
 	}
 }
 
-void Score::loadSpriteImages(bool isSharedCast) {
-	debugC(1, kDebugLoading, "****** Preloading sprite images");
-
-	Common::HashMap<int, BitmapCast *>::iterator bc;
-	for (bc = _loadedBitmaps->begin(); bc != _loadedBitmaps->end(); ++bc) {
-		if (bc->_value) {
-			uint32 tag = bc->_value->tag;
-			uint16 imgId = bc->_key + 1024;
-			BitmapCast *bitmapCast = bc->_value;
+Image::ImageDecoder *Score::loadSpriteImage(uint16 castId) {
+	BitmapCast *bitmapCast = _loadedBitmaps->getVal(castId, nullptr);
+	if (!bitmapCast)
+		return nullptr;
 
-			if (_vm->getVersion() >= 4 && bitmapCast->children.size() > 0) {
-				imgId = bitmapCast->children[0].index;
-				tag = bitmapCast->children[0].tag;
-			}
+	bool isSharedCast = (this == _vm->getSharedScore());
+	uint32 tag = bitmapCast->tag;
+	uint16 imgId = castId + 1024;
 
-			Image::ImageDecoder *img = NULL;
-			Common::SeekableReadStream *pic = NULL;
-
-			switch (tag) {
-			case MKTAG('D', 'I', 'B', ' '):
-				if (_movieArchive->hasResource(MKTAG('D', 'I', 'B', ' '), imgId)) {
-					img = new DIBDecoder();
-					img->loadStream(*_movieArchive->getResource(MKTAG('D', 'I', 'B', ' '), imgId));
-					bitmapCast->surface = img->getSurface();
-				} else if (isSharedCast && _vm->getSharedDIB() != NULL && _vm->getSharedDIB()->contains(imgId)) {
-					img = new DIBDecoder();
-					img->loadStream(*_vm->getSharedDIB()->getVal(imgId));
-					bitmapCast->surface = img->getSurface();
-				}
-				break;
-			case MKTAG('B', 'I', 'T', 'D'):
-				if (isSharedCast) {
-					debugC(4, kDebugImages, "Shared cast BMP: id: %d", imgId);
-					pic = _vm->getSharedBMP()->getVal(imgId);
-					if (pic != NULL)
-						pic->seek(0); // TODO: this actually gets re-read every loop... we need to rewind it!
-				} else 	if (_movieArchive->hasResource(MKTAG('B', 'I', 'T', 'D'), imgId)) {
-					pic = _movieArchive->getResource(MKTAG('B', 'I', 'T', 'D'), imgId);
-				}
-				break;
-			default:
-				warning("Unknown Bitmap Cast Tag: [%d] %s", tag, tag2str(tag));
-				break;
-			}
+	if (_vm->getVersion() >= 4 && bitmapCast->children.size() > 0) {
+		imgId = bitmapCast->children[0].index;
+		tag = bitmapCast->children[0].tag;
+	}
 
-			int w = bitmapCast->initialRect.width(), h = bitmapCast->initialRect.height();
-			debugC(4, kDebugImages, "id: %d, w: %d, h: %d, flags: %x, some: %x, unk1: %d, unk2: %d",
-				imgId, w, h, bitmapCast->flags, bitmapCast->someFlaggyThing, bitmapCast->unk1, bitmapCast->unk2);
+	Image::ImageDecoder *img = NULL;
+	Common::SeekableReadStream *pic = NULL;
+
+	switch (tag) {
+	case MKTAG('D', 'I', 'B', ' '):
+		if (_movieArchive->hasResource(MKTAG('D', 'I', 'B', ' '), imgId)) {
+			img = new DIBDecoder();
+			pic = _movieArchive->getResource(MKTAG('D', 'I', 'B', ' '), imgId);
+			img->loadStream(*pic);
+			delete pic;
+			return img;
+		} else if (isSharedCast && _vm->getSharedDIB() != NULL && _vm->getSharedDIB()->contains(imgId)) {
+			img = new DIBDecoder();
+			pic = _vm->getSharedDIB()->getVal(imgId);
+			pic->seek(0);
+			img->loadStream(*pic);
+			return img;
+		}
+		break;
+	case MKTAG('B', 'I', 'T', 'D'):
+		if (isSharedCast) {
+			debugC(4, kDebugImages, "Shared cast BMP: id: %d", imgId);
+			pic = _vm->getSharedBMP()->getVal(imgId);
+			// The shared streams are kept open, so rewind them for every decode
+			if (pic != NULL)
+				pic->seek(0);
+		} else 	if (_movieArchive->hasResource(MKTAG('B', 'I', 'T', 'D'), imgId)) {
+			pic = _movieArchive->getResource(MKTAG('B', 'I', 'T', 'D'), imgId);
+		}
+		break;
+	default:
+		warning("Unknown Bitmap Cast Tag: [%d] %s", tag, tag2str(tag));
+		break;
+	}
 
-			if (pic != NULL && bitmapCast != NULL && w > 0 && h > 0) {
-				if (_vm->getVersion() < 4) {
-					img = new BITDDecoder(w, h);
-				} else if (_vm->getVersion() < 6) {
-					img = new BITDDecoderV4(w, h, bitmapCast->bitsPerPixel);
-				} else {
-					img = new Image::BitmapDecoder();
-				}
+	int w = bitmapCast->initialRect.width(), h = bitmapCast->initialRect.height();
+	debugC(4, kDebugImages, "id: %d, w: %d, h: %d, flags: %x, some: %x, unk1: %d, unk2: %d",
+		imgId, w, h, bitmapCast->flags, bitmapCast->someFlaggyThing, bitmapCast->unk1, bitmapCast->unk2);
 
-				img->loadStream(*pic);
-				bitmapCast->surface = img->getSurface();
-			} else {
-				warning("Image %d not found", imgId);
-			}
+	if (pic != NULL && w > 0 && h > 0) {
+		if (_vm->getVersion() < 4) {
+			img = new BITDDecoder(w, h);
+		} else if (_vm->getVersion() < 6) {
+			img = new BITDDecoderV4(w, h, bitmapCast->bitsPerPixel);
+		} else {
+			img = new Image::BitmapDecoder();
 		}
+
+		img->loadStream(*pic);
+		if (!isSharedCast)
+			delete pic;
+		return img;
 	}
+
+	if (!isSharedCast)
+		delete pic;
+	warning("Image %d not found", imgId);
+	return nullptr;
 }
 
 Score::~Score() {
+	_vm->purgeBitmapCache(this);
+
 	if (_surface)
 		_surface->free();
 
@@ -719,6 +728,10 @@ Common::Rect Score::getCastMemberInitialRect(int castId) {
 }
 
 void Score::setCastMemberModified(int castId) {
+	// Sprites showing the member may look different without any of their
+	// channels changing
+	_fullRedraw = true;
+
 	switch (_castTypes[castId]) {
 	case kCastBitmap:
 		_loadedBitmaps->getVal(castId)->modified = 1;
@@ -1180,6 +1193,11 @@ void Score::startLoop() {
 	else
 		_trailSurface->clear(_stageColor);
 
+	_channelStates.clear();
+	_channelStates.resize(CHANNEL_COUNT);
+	_trailDamage = Common::Rect();
+	_fullRedraw = true;
+
 	_currentFrame = 0;
 	_stopPlay = false;
 	_nextFrameTime = 0;
@@ -1199,9 +1217,6 @@ void Score::update() {
 	if (g_system->getMillis() < _nextFrameTime)
 		return;
 
-	_surface->clear();
-	_surface->copyFrom(*_trailSurface);
-
 	_lingo->executeImmediateScripts(_frames[_currentFrame]);
 
 	// Enter and exit from previous frame (Director 4)
@@ -28,6 +28,7 @@
 #include "director/archive.h"
 #include "director/cast.h"
 #include "director/images.h"
+#include "director/sprite.h"
 #include "director/stxt.h"
 
 namespace Graphics {
@@ -82,7 +83,11 @@ public:
 	Common::String getMacName() const { return _macName; }
 	Sprite *getSpriteById(uint16 id);
 	void setSpriteCasts();
-	void loadSpriteImages(bool isSharedCast);
+	/**
+	 * Decodes the image of a bitmap cast member.
+	 * @return the decoder holding the image, or nullptr if it can't be loaded
+	 */
+	Image::ImageDecoder *loadSpriteImage(uint16 castId);
 	void copyCastStxts();
 	Graphics::ManagedSurface *getSurface() { return _surface; }
 
@@ -126,6 +131,10 @@ public:
 	Common::Rect _movieRect;
 	uint16 _currentMouseDownSpriteId;
 
+	Common::Array<ChannelState> _channelStates; ///< What each sprite channel shows on the stage
+	Common::Rect _trailDamage; ///< Where trails were drawn since the stage was last composited
+	bool _fullRedraw; ///< Whether the next frame has to composite the whole stage
+
 	bool _stopPlay;
 	uint32 _nextFrameTime;
 
@@ -125,4 +125,50 @@ Sprite::~Sprite() {
 		delete _buttonCast;
 }
 
+ChannelState::ChannelState() {
+	enabled = false;
+	trails = 0;
+	castId = 0;
+	spriteType = 0;
+	ink = kInkTypeCopy;
+	bitmapCast = nullptr;
+	textCast = nullptr;
+	buttonCast = nullptr;
+	width = 0;
+	height = 0;
+	backColor = 0;
+	foreColor = 0;
+	lineSize = 0;
+	highlighted = false;
+}
+
+bool ChannelState::matches(const Sprite &sprite, bool highlighted_) const {
+	if (!enabled || !sprite._enabled)
+		return enabled == sprite._enabled;
+
+	return trails == sprite._trails && castId == sprite._castId && spriteType == sprite._spriteType &&
+		ink == sprite._ink && bitmapCast == sprite._bitmapCast && textCast == sprite._textCast &&
+		buttonCast == sprite._buttonCast && startPoint == sprite._startPoint &&
+		width == sprite._width && height == sprite._height && backColor == sprite._backColor &&
+		foreColor == sprite._foreColor && lineSize == sprite._lineSize && highlighted == highlighted_;
+}
+
+void ChannelState::update(const Sprite &sprite, bool highlighted_) {
+	enabled = sprite._enabled;
+	trails = sprite._trails;
+	castId = sprite._castId;
+	spriteType = sprite._spriteType;
+	ink = sprite._ink;
+	bitmapCast = sprite._bitmapCast;
+	textCast = sprite._textCast;
+	buttonCast = sprite._buttonCast;
+	startPoint = sprite._startPoint;
+	width = sprite._width;
+	height = sprite._height;
+	backColor = sprite._backColor;
+	foreColor = sprite._foreColor;
+	lineSize = sprite._lineSize;
+	highlighted = highlighted_;
+}
+
 } // End of namespace Director
@@ -23,6 +23,7 @@
 #ifndef DIRECTOR_SPRITE_H
 #define DIRECTOR_SPRITE_H
 
+#include "common/array.h"
 #include "common/rect.h"
 
 namespace Director {
@@ -148,6 +149,36 @@ public:
 	Common::String _editableText;
 };
 
+/**
+ * What a sprite channel showed on the stage when it was last drawn, to find
+ * out which channels changed from one frame to the next.
+ */
+struct ChannelState {
+	ChannelState();
+
+	bool matches(const Sprite &sprite, bool highlighted) const;
+	void update(const Sprite &sprite, bool highlighted);
+
+	bool enabled;
+	uint16 trails;
+	uint16 castId;
+	byte spriteType;
+	InkType ink;
+	const BitmapCast *bitmapCast;
+	const TextCast *textCast;
+	const ButtonCast *buttonCast;
+	Common::Point startPoint;
+	uint16 width;
+	uint16 height;
+	byte backColor;
+	byte foreColor;
+	byte lineSize;
+	bool highlighted;
+
+	Common::Rect bounds;                   ///< Stage area painted by the sprite
+	Common::Array<Common::Rect> drawRects; ///< Where the sprite can be clicked
+};
+
 } // End of namespace Director
 
 #endif
@@ -29,7 +29,7 @@ void Glulxe::execute_loop() {
 	bool done_executing = false;
 	int ix;
 	uint opcode;
-	const operandlist_t *oplist;
+	const decodedinstr_t *instr;
 	oparg_t inst[MAX_OPERANDS];
 	uint value, addr, val0, val1;
 	int vals0, vals1;
@@ -49,44 +49,15 @@ void Glulxe::execute_loop() {
 		/* Stash the current opcode's address, in case the interpreter needs to serialize the VM state out-of-band. */
 		prevpc = pc;
 
-		/* Fetch the opcode number. */
-		opcode = Mem1(pc);
-		pc++;
-		if (opcode & 0x80) {
-			/* More than one-byte opcode. */
-			if (opcode & 0x40) {
-				/* Four-byte opcode */
-				opcode &= 0x3F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-			} else {
-				/* Two-byte opcode */
-				opcode &= 0x7F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-			}
-		}
-
-		/* Now we have an opcode number. */
-
-		/* Fetch the structure that describes how the operands for this
-		   opcode are arranged. This is a pointer to an immutable,
-		   static object. */
-		if (opcode < 0x80)
-			oplist = fast_operandlist[opcode];
-		else
-			oplist = lookup_operandlist(opcode);
-
-		if (!oplist)
-			fatal_error_i("Encountered unknown opcode.", opcode);
+		/* Fetch the decoded instruction, parsing its opcode and operand
+		   modes unless it was already run before. */
+		instr = fetch_instruction();
+		opcode = instr->opcode;
 
-		/* Based on the oplist structure, load the actual operand values
-		   into inst. This moves the PC up to the end of the instruction. */
-		parse_operands(inst, oplist);
+		/* Load the actual operand values into inst, and move the PC up
+		   to the end of the instruction. */
+		load_operands(inst, instr);
+		pc = instr->nextpc;
 
 		/* Perform the opcode. This switch statement is split in two, based
 		   on some paranoid suspicions about the ability of compilers to
@@ -1176,6 +1176,9 @@ void Glulxe::glulxe_retained_unregister(void *array, uint len, const  char *type
 		elemsize = 4;
 
 	if (!elemsize || array == nullptr) {
+		/* Glk is done writing into the array. */
+		if (array)
+			glulxe_raw_array_written((unsigned char *)array - memmap, len);
 		return;
 	}
 
@@ -1256,6 +1259,7 @@ gidispatch_rock_t Glulxe::glulxe_array_restore(long bufkey, uint len, char *type
 
 	if (!elemsize) {
 		unsigned char *buf = memmap + bufkey;
+		glulxe_raw_array_written(bufkey, len);
 		*arrayref = buf;
 		rock.ptr = nullptr;
 		return rock;
@@ -1273,6 +1277,23 @@ gidispatch_rock_t Glulxe::glulxe_array_restore(long bufkey, uint len, char *type
 	return rock;
 }
 
+void Glulxe::glulxe_raw_array_written(uint addr, uint len) {
+	/* The element size isn't known, so assume the widest. */
+	uint end = addr + len * 4;
+
+	if (!len)
+		return;
+
+	if (addr < ramstart) {
+		flush_decode_cache();
+		/* Decoded strings in ROM, and a table there, may be stale too. */
+		if (tablecache_valid)
+			stream_table_written();
+	} else if (addr < tablecache_ramend && end > stringtable) {
+		stream_table_written();
+	}
+}
+
 void Glulxe::set_library_select_hook(void (*func)(uint)) {
 	library_select_hook = func;
 }
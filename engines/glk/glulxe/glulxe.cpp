@@ -34,7 +34,7 @@ Glulxe::Glulxe(OSystem *syst, const GlkGameDescription &gameDesc) : GlkAPI(syst,
 		ramstart(0), endgamefile(0), origendmem(0),  stacksize(0), startfuncaddr(0), checksum(0),
 		stackptr(0), frameptr(0), pc(0), prevpc(0), origstringtable(0), stringtable(0), valstackbase(0),
 		localsbase(0), endmem(0), protectstart(0), protectend(0),
-		stream_char_handler(nullptr), stream_unichar_handler(nullptr),
+		stream_char_handler(nullptr), stream_unichar_handler(nullptr), decodecache(nullptr),
 		// main
 		library_autorestore_hook(nullptr),
 		// accel
@@ -46,8 +46,10 @@ Glulxe::Glulxe(OSystem *syst, const GlkGameDescription &gameDesc) : GlkAPI(syst,
 		// serial
 		max_undo_level(8), undo_chain_size(0), undo_chain_num(0), undo_chain(nullptr), ramcache(nullptr),
 		// string
-		iosys_mode(0), iosys_rock(0), tablecache_valid(false), glkio_unichar_han_ptr(nullptr) {
+		iosys_mode(0), iosys_rock(0), tablecache_valid(false), tablecache_ramend(0), tablecache_stale(false),
+		glkio_unichar_han_ptr(nullptr) {
 	g_vm = this;
+	memset(stringcache, 0, sizeof(stringcache));
 
 	glkopInit();
 }
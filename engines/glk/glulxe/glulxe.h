@@ -143,6 +143,19 @@ private:
 	 */
 	const operandlist_t *fast_operandlist[0x80];
 
+	/**
+	 * Instructions in ROM which have already been decoded, indexed by the low bits of their address.
+	 * Code in RAM may be rewritten by the game at any time, so it isn't cached. The MemW*() checks
+	 * keep the game from writing to ROM, but Glk writes untyped arrays in place, so those flush
+	 * the cache when they reach below ramstart.
+	 */
+	decodedinstr_t *decodecache;
+
+	/**
+	 * Scratch space for decoding an instruction in RAM
+	 */
+	decodedinstr_t raminstr;
+
 	/**@}*/
 
 	/**
@@ -180,6 +193,23 @@ private:
 	bool tablecache_valid;
 	cacheblock_t tablecache;
 
+	/**
+	 * End of the string table when its decoding tables were built from RAM, or 0. Writes below
+	 * this address which fall within the string table invalidate the tables, whether made by
+	 * the game through MemW*() or by Glk into an untyped array.
+	 */
+	uint tablecache_ramend;
+
+	/**
+	 * Set when the string table in RAM was written to, so the tables have to be built again
+	 */
+	bool tablecache_stale;
+
+	/**
+	 * Recently printed compressed strings in ROM, already decoded
+	 */
+	stringcache_t stringcache[STRING_CACHE_SIZE];
+
 	/* This misbehaves if a Glk function has more than one S argument. */
 #define STATIC_TEMP_BUFSIZE (127)
 	char temp_buf[STATIC_TEMP_BUFSIZE + 1];
@@ -283,6 +313,12 @@ protected:
 	long glulxe_array_locate(void *array, uint len, char *typecode, gidispatch_rock_t objrock, int *elemsizeref);
 	gidispatch_rock_t glulxe_array_restore(long bufkey, uint len, char *typecode, void **arrayref);
 
+	/**
+	 * Glk writes into untyped arrays in place, bypassing the MemW*() checks. Drop anything cached
+	 * from the memory such an array covers.
+	 */
+	void glulxe_raw_array_written(uint addr, uint len);
+
 	char *grab_temp_c_array(uint addr, uint len, int passin);
 	void release_temp_c_array(char *arr, uint addr, uint len, int passout);
 	uint *grab_temp_i_array(uint addr, uint len, int passin);
@@ -386,6 +422,33 @@ protected:
 
 	void dropcache(cacheblock_t *cablist);
 	void buildcache(cacheblock_t *cablist, uint nodeaddr, int depth, int mask);
+
+	/**
+	 * Build the decoding tables for the current string table
+	 */
+	void build_tablecache();
+
+	/**
+	 * Drop the decoding tables, along with any strings which were decoded with them
+	 */
+	void drop_tablecache();
+
+	/**
+	 * Called when the string table in RAM was written to
+	 */
+	void stream_table_written();
+
+	/**
+	 * Print a compressed string from the decoded string cache, decoding it first if needed.
+	 * @returns     False if the string can't be printed this way, and has to be decoded as it's printed
+	 */
+	bool stream_cached_string(uint addr);
+
+	/**
+	 * Decode a compressed string in full into a decoded string cache entry. Fails if the string
+	 * is too long or contains indirect references, which have to be resolved as it's printed.
+	 */
+	bool decode_cached_string(uint addr, stringcache_t *entry);
 	void dumpcache(cacheblock_t *cablist, int count, int indent);
 
 	/**@}*/
@@ -523,6 +586,11 @@ public:
 	 */
 	void init_operands();
 
+	/**
+	 * Forget all the decoded instructions
+	 */
+	void flush_decode_cache();
+
 	/**
 	 * Return the operandlist for a given opcode. For opcodes in the range 00..7F, it's faster
 	 * to use the array fast_operandlist[].
@@ -530,13 +598,23 @@ public:
 	const operandlist_t *lookup_operandlist(uint opcode);
 
 	/**
-	 * Read the list of operands of an instruction, and put the values in args. This assumes
-	 * that the PC is at the beginning of the operand mode list (right after an opcode number.)
-	 * Upon return, the PC will be at the beginning of the next instruction.
+	 * Parse the opcode and the operand modes of the instruction at addr into instr. Constant
+	 * operands and operand addresses are read as well, but no operand values are fetched.
+	 */
+	void decode_instruction(decodedinstr_t *instr, uint addr);
+
+	/**
+	 * Return the decoded instruction at the PC, from the decode cache when the code is in ROM.
+	 */
+	const decodedinstr_t *fetch_instruction();
+
+	/**
+	 * Fetch the operand values of a decoded instruction, and put them in args. Stack operands
+	 * are popped, and memory and locals operands are read, in operand order.
 	 *
-	 * This also assumes that args points at an allocated array of MAX_OPERANDS oparg_t structures.
+	 * This assumes that args points at an allocated array of MAX_OPERANDS oparg_t structures.
 	*/
-	void parse_operands(oparg_t *opargs, const operandlist_t *oplist);
+	void load_operands(oparg_t *opargs, const decodedinstr_t *instr);
 
 	/**
 	 * Store a result value, according to the desttype and destaddress given. This is usually used to store
@@ -92,9 +92,16 @@ class Glulxe;
 #define Mem1(adr)  (Read1(memmap+(adr)))
 #define Mem2(adr)  (Read2(memmap+(adr)))
 #define Mem4(adr)  (Read4(memmap+(adr)))
-#define MemW1(adr, vl)  (VerifyW(adr, 1), Write1(memmap+(adr), (vl)))
-#define MemW2(adr, vl)  (VerifyW(adr, 2), Write2(memmap+(adr), (vl)))
-#define MemW4(adr, vl)  (VerifyW(adr, 4), Write4(memmap+(adr), (vl)))
+#define MemW1(adr, vl)  (VerifyW(adr, 1), VerifyTable(adr, 1), Write1(memmap+(adr), (vl)))
+#define MemW2(adr, vl)  (VerifyW(adr, 2), VerifyTable(adr, 2), Write2(memmap+(adr), (vl)))
+#define MemW4(adr, vl)  (VerifyW(adr, 4), VerifyTable(adr, 4), Write4(memmap+(adr), (vl)))
+
+/**
+ * Drops the decoding tables of a string table in RAM when it gets written to. Glk writes untyped
+ * arrays without going through here, see glulxe_raw_array_written().
+ */
+#define VerifyTable(adr, ln) \
+	(((adr) < tablecache_ramend && (adr) + (ln) > stringtable) ? stream_table_written() : (void)0)
 
 #ifndef _HUGE_ENUF
 #define _HUGE_ENUF  1e+300  // _HUGE_ENUF*_HUGE_ENUF must overflow
@@ -352,6 +359,45 @@ typedef oparg_struct oparg_t;
 
 #define MAX_OPERANDS (8)
 
+/**
+ * Number of entries in the decoded instruction cache. Must be a power of two.
+ */
+#define DECODE_CACHE_SIZE (8192)
+
+/**
+ * How a decoded operand gets its value when the instruction is executed
+ */
+enum decodedkind {
+	decoded_Const = 0,      ///< Value is the operand itself
+	decoded_Stack = 1,      ///< Popped off the stack
+	decoded_Mem = 2,        ///< Read from main memory at the address in value
+	decoded_Locals = 3,     ///< Read from the locals segment at the offset in value
+	decoded_Store = 4       ///< Store operand, desttype and value are already resolved
+};
+
+/**
+ * One operand of a decoded instruction.
+ */
+struct decodedarg_struct {
+	byte kind;
+	byte desttype;
+	uint value;
+};
+typedef decodedarg_struct decodedarg_t;
+
+/**
+ * An instruction whose opcode and operand modes have already been parsed, so that executing
+ * it again only has to fetch the operand values.
+ */
+struct decodedinstr_struct {
+	uint addr;              ///< Address of the instruction, or 0xFFFFFFFF for an unused cache entry
+	uint nextpc;            ///< Address of the following instruction
+	uint opcode;
+	const operandlist_t *oplist;
+	decodedarg_t args[MAX_OPERANDS];
+};
+typedef decodedinstr_struct decodedinstr_t;
+
 typedef uint(Glulxe::*acceleration_func)(uint argc, uint *argv);
 
 struct accelentry_struct {
@@ -414,6 +460,29 @@ struct cacheblock_struct {
 };
 typedef cacheblock_struct cacheblock_t;
 
+/**
+ * Number of entries in the decoded string cache. Must be a power of two.
+ */
+#define STRING_CACHE_SIZE (1024)
+
+/**
+ * Longest string, in characters, which is kept in the decoded string cache
+ */
+#define STRING_CACHE_MAXLEN (1024)
+
+/**
+ * A compressed string which has already been decoded. Characters which are to be printed
+ * as Unicode have STRING_CACHE_UNICODE set.
+ */
+struct stringcache_struct {
+	uint addr;      ///< Address of the string, or 0 for an unused entry
+	int len;        ///< Number of characters, or -1 if the string can't be cached
+	uint32 *chars;
+};
+typedef stringcache_struct stringcache_t;
+
+#define STRING_CACHE_UNICODE (0x80000000)
+
 } // End of namespace Glulxe
 } // End of namespace Glk
 
@@ -67,6 +67,18 @@ static const operandlist_t list_LLSS = { 4, 4, &array_LLSS[0] };
 void Glulxe::init_operands() {
 	for (int ix = 0; ix < 0x80; ix++)
 		fast_operandlist[ix] = lookup_operandlist(ix);
+
+	if (!decodecache) {
+		decodecache = (decodedinstr_t *)glulx_malloc(DECODE_CACHE_SIZE * sizeof(decodedinstr_t));
+		if (!decodecache)
+			fatal_error("Unable to allocate instruction cache.");
+	}
+	flush_decode_cache();
+}
+
+void Glulxe::flush_decode_cache() {
+	for (int ix = 0; ix < DECODE_CACHE_SIZE; ix++)
+		decodecache[ix].addr = 0xFFFFFFFF;
 }
 
 const operandlist_t *Glulxe::lookup_operandlist(uint opcode) {
@@ -280,22 +292,59 @@ const operandlist_t *Glulxe::lookup_operandlist(uint opcode) {
 	}
 }
 
-void Glulxe::parse_operands(oparg_t *args, const operandlist_t *oplist) {
+void Glulxe::decode_instruction(decodedinstr_t *instr, uint addr) {
 	int ix;
-	oparg_t *curarg;
+	decodedarg_t *curarg;
+	const operandlist_t *oplist;
+	uint opcode;
+
+	instr->addr = addr;
+
+	/* Fetch the opcode number. */
+	opcode = Mem1(addr);
+	addr++;
+	if (opcode & 0x80) {
+		/* More than one-byte opcode. */
+		if (opcode & 0x40) {
+			/* Four-byte opcode */
+			opcode &= 0x3F;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+		} else {
+			/* Two-byte opcode */
+			opcode &= 0x7F;
+			opcode = (opcode << 8) | Mem1(addr);
+			addr++;
+		}
+	}
+
+	/* Fetch the structure that describes how the operands for this
+	   opcode are arranged. This is a pointer to an immutable,
+	   static object. */
+	if (opcode < 0x80)
+		oplist = fast_operandlist[opcode];
+	else
+		oplist = lookup_operandlist(opcode);
+
+	if (!oplist)
+		fatal_error_i("Encountered unknown opcode.", opcode);
+
+	instr->opcode = opcode;
+	instr->oplist = oplist;
+
 	int numops = oplist->num_ops;
-	int argsize = oplist->arg_size;
-	uint modeaddr = pc;
+	uint modeaddr = addr;
 	int modeval = 0;
 
-	pc += (numops + 1) / 2;
+	addr += (numops + 1) / 2;
 
-	for (ix = 0, curarg = args; ix < numops; ix++, curarg++) {
+	for (ix = 0, curarg = instr->args; ix < numops; ix++, curarg++) {
 		int mode;
-		uint value;
-		uint addr;
-
-		curarg->desttype = 0;
+		uint value = 0;
 
 		if ((ix & 1) == 0) {
 			modeval = Mem1(modeaddr);
@@ -305,126 +354,92 @@ void Glulxe::parse_operands(oparg_t *args, const operandlist_t *oplist) {
 			modeaddr++;
 		}
 
+		/* Read the constant or address following the modes, if any. */
+		switch (mode) {
+		case 1: /* one-byte constant or address */
+		case 5:
+		case 9:
+		case 13:
+			if (mode == 1) {
+				/* Sign-extend from 8 bits to 32 */
+				value = (int)(signed char)(Mem1(addr));
+			} else {
+				value = (uint)(Mem1(addr));
+			}
+			addr++;
+			break;
+
+		case 2: /* two-byte constant or address */
+		case 6:
+		case 10:
+		case 14:
+			if (mode == 2) {
+				/* Sign-extend the first byte from 8 bits to 32; the subsequent
+				   byte must not be sign-extended. */
+				value = (int)(signed char)(Mem1(addr));
+				value = (value << 8) | (uint)(Mem1(addr + 1));
+			} else {
+				value = (uint)Mem2(addr);
+			}
+			addr += 2;
+			break;
+
+		case 3: /* four-byte constant or address */
+		case 7:
+		case 11:
+		case 15:
+			/* Bytes must not be sign-extended. */
+			value = Mem4(addr);
+			addr += 4;
+			break;
+
+		default:
+			break;
+		}
+
+		/* Cases 13, 14, 15 are main memory addresses relative to the start of RAM. */
+		if (mode >= 13)
+			value += ramstart;
+
+		curarg->desttype = 0;
+		curarg->value = value;
+
 		if (oplist->formlist[ix] == modeform_Load) {
 
 			switch (mode) {
-
 			case 8: /* pop off stack */
-				if (stackptr < valstackbase + 4) {
-					fatal_error("Stack underflow in operand.");
-				}
-				stackptr -= 4;
-				value = Stk4(stackptr);
+				curarg->kind = decoded_Stack;
 				break;
 
 			case 0: /* constant zero */
-				value = 0;
-				break;
-
 			case 1: /* one-byte constant */
-				/* Sign-extend from 8 bits to 32 */
-				value = (int)(signed char)(Mem1(pc));
-				pc++;
-				break;
-
 			case 2: /* two-byte constant */
-				/* Sign-extend the first byte from 8 bits to 32; the subsequent
-				   byte must not be sign-extended. */
-				value = (int)(signed char)(Mem1(pc));
-				pc++;
-				value = (value << 8) | (uint)(Mem1(pc));
-				pc++;
-				break;
-
 			case 3: /* four-byte constant */
-				/* Bytes must not be sign-extended. */
-				value = Mem4(pc);
-				pc += 4;
+				curarg->kind = decoded_Const;
 				break;
 
-			case 15: /* main memory RAM, four-byte address */
-				addr = Mem4(pc);
-				addr += ramstart;
-				pc += 4;
-				goto MainMemAddr;
-
-			case 14: /* main memory RAM, two-byte address */
-				addr = (uint)Mem2(pc);
-				addr += ramstart;
-				pc += 2;
-				goto MainMemAddr;
-
-			case 13: /* main memory RAM, one-byte address */
-				addr = (uint)(Mem1(pc));
-				addr += ramstart;
-				pc++;
-				goto MainMemAddr;
-
-			case 7: /* main memory, four-byte address */
-				addr = Mem4(pc);
-				pc += 4;
-				goto MainMemAddr;
-
-			case 6: /* main memory, two-byte address */
-				addr = (uint)Mem2(pc);
-				pc += 2;
-				goto MainMemAddr;
-
-			case 5: /* main memory, one-byte address */
-				addr = (uint)(Mem1(pc));
-				pc++;
-				/* fall through */
-
-MainMemAddr:
-				/* cases 5, 6, 7, 13, 14, 15 all wind up here. */
-				if (argsize == 4) {
-					value = Mem4(addr);
-				} else if (argsize == 2) {
-					value = Mem2(addr);
-				} else {
-					value = Mem1(addr);
-				}
+			case 5: /* main memory */
+			case 6:
+			case 7:
+			case 13: /* main memory RAM */
+			case 14:
+			case 15:
+				curarg->kind = decoded_Mem;
 				break;
 
-			case 11: /* locals, four-byte address */
-				addr = Mem4(pc);
-				pc += 4;
-				goto LocalsAddr;
-
-			case 10: /* locals, two-byte address */
-				addr = (uint)Mem2(pc);
-				pc += 2;
-				goto LocalsAddr;
-
-			case 9: /* locals, one-byte address */
-				addr = (uint)(Mem1(pc));
-				pc++;
-				/* fall through */
-
-LocalsAddr:
-				/* cases 9, 10, 11 all wind up here. It's illegal for addr to not
-				   be four-byte aligned, but we don't check this explicitly.
-				   A "strict mode" interpreter probably should. It's also illegal
-				   for addr to be less than zero or greater than the size of
-				   the locals segment. */
-				addr += localsbase;
-				if (argsize == 4) {
-					value = Stk4(addr);
-				} else if (argsize == 2) {
-					value = Stk2(addr);
-				} else {
-					value = Stk1(addr);
-				}
+			case 9: /* locals */
+			case 10:
+			case 11:
+				curarg->kind = decoded_Locals;
 				break;
 
 			default:
-				value = 0;
 				fatal_error("Unknown addressing mode in load operand.");
 			}
 
-			curarg->value = value;
-
 		} else { /* modeform_Store */
+			curarg->kind = decoded_Store;
+
 			switch (mode) {
 
 			case 0: /* discard value */
@@ -437,71 +452,22 @@ LocalsAddr:
 				curarg->value = 0;
 				break;
 
-			case 15: /* main memory RAM, four-byte address */
-				addr = Mem4(pc);
-				addr += ramstart;
-				pc += 4;
-				goto WrMainMemAddr;
-
-			case 14: /* main memory RAM, two-byte address */
-				addr = (uint)Mem2(pc);
-				addr += ramstart;
-				pc += 2;
-				goto WrMainMemAddr;
-
-			case 13: /* main memory RAM, one-byte address */
-				addr = (uint)(Mem1(pc));
-				addr += ramstart;
-				pc++;
-				goto WrMainMemAddr;
-
-			case 7: /* main memory, four-byte address */
-				addr = Mem4(pc);
-				pc += 4;
-				goto WrMainMemAddr;
-
-			case 6: /* main memory, two-byte address */
-				addr = (uint)Mem2(pc);
-				pc += 2;
-				goto WrMainMemAddr;
-
-			case 5: /* main memory, one-byte address */
-				addr = (uint)(Mem1(pc));
-				pc++;
-				/* fall through */
-
-WrMainMemAddr:
-				/* cases 5, 6, 7 all wind up here. */
+			case 5: /* main memory */
+			case 6:
+			case 7:
+			case 13: /* main memory RAM */
+			case 14:
+			case 15:
 				curarg->desttype = 1;
-				curarg->value = addr;
 				break;
 
-			case 11: /* locals, four-byte address */
-				addr = Mem4(pc);
-				pc += 4;
-				goto WrLocalsAddr;
-
-			case 10: /* locals, two-byte address */
-				addr = (uint)Mem2(pc);
-				pc += 2;
-				goto WrLocalsAddr;
-
-			case 9: /* locals, one-byte address */
-				addr = (uint)(Mem1(pc));
-				pc++;
-				/* fall through */
-
-WrLocalsAddr:
-				/* cases 9, 10, 11 all wind up here. It's illegal for addr to not
-				   be four-byte aligned, but we don't check this explicitly.
-				   A "strict mode" interpreter probably should. It's also illegal
-				   for addr to be less than zero or greater than the size of
-				   the locals segment. */
-				curarg->desttype = 2;
+			case 9: /* locals */
+			case 10:
+			case 11:
 				/* We don't add localsbase here; the store address for desttype 2
 				   is relative to the current locals segment, not an absolute
 				   stack position. */
-				curarg->value = addr;
+				curarg->desttype = 2;
 				break;
 
 			case 1:
@@ -515,6 +481,83 @@ WrLocalsAddr:
 			}
 		}
 	}
+
+	instr->nextpc = addr;
+}
+
+const decodedinstr_t *Glulxe::fetch_instruction() {
+	if (pc >= ramstart) {
+		/* Code in RAM may have been rewritten since it last ran. */
+		decode_instruction(&raminstr, pc);
+		return &raminstr;
+	}
+
+	/* The game can't write to ROM, so a decoded instruction stays valid
+	   until Glk writes an untyped array over it; see
+	   glulxe_raw_array_written(). */
+	decodedinstr_t *instr = &decodecache[pc & (DECODE_CACHE_SIZE - 1)];
+	if (instr->addr != pc)
+		decode_instruction(instr, pc);
+
+	return instr;
+}
+
+void Glulxe::load_operands(oparg_t *args, const decodedinstr_t *instr) {
+	int ix;
+	oparg_t *curarg;
+	const decodedarg_t *decarg;
+	int numops = instr->oplist->num_ops;
+	int argsize = instr->oplist->arg_size;
+
+	for (ix = 0, curarg = args, decarg = instr->args; ix < numops; ix++, curarg++, decarg++) {
+		uint addr;
+
+		curarg->desttype = decarg->desttype;
+
+		switch (decarg->kind) {
+		case decoded_Const:
+		case decoded_Store:
+			curarg->value = decarg->value;
+			break;
+
+		case decoded_Stack:
+			if (stackptr < valstackbase + 4) {
+				fatal_error("Stack underflow in operand.");
+			}
+			stackptr -= 4;
+			curarg->value = Stk4(stackptr);
+			break;
+
+		case decoded_Mem:
+			addr = decarg->value;
+			if (argsize == 4) {
+				curarg->value = Mem4(addr);
+			} else if (argsize == 2) {
+				curarg->value = Mem2(addr);
+			} else {
+				curarg->value = Mem1(addr);
+			}
+			break;
+
+		case decoded_Locals:
+			/* It's illegal for addr to not be four-byte aligned, but we don't
+			   check this explicitly. A "strict mode" interpreter probably should.
+			   It's also illegal for addr to be less than zero or greater than
+			   the size of the locals segment. */
+			addr = decarg->value + localsbase;
+			if (argsize == 4) {
+				curarg->value = Stk4(addr);
+			} else if (argsize == 2) {
+				curarg->value = Stk2(addr);
+			} else {
+				curarg->value = Stk1(addr);
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
 }
 
 void Glulxe::store_operand(uint desttype, uint destaddr, uint storeval) {
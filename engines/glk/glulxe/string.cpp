@@ -170,6 +170,13 @@ void Glulxe::stream_string(uint addr, int inmiddle, int bitnum) {
 	if (!addr)
 		fatal_error("Called stream_string with null address.");
 
+	if (tablecache_stale)
+		build_tablecache();
+
+	/* Strings printed straight to Glk can be decoded once and for all. */
+	if (inmiddle == 0 && iosys_mode == iosys_Glk && addr < ramstart && stream_cached_string(addr))
+		return;
+
 	while (!alldone) {
 
 		if (inmiddle == 0) {
@@ -620,28 +627,191 @@ void Glulxe::stream_set_table(uint addr) {
 		return;
 
 	/* Drop cache. */
+	drop_tablecache();
+
+	stringtable = addr;
+
+	if (stringtable)
+		build_tablecache();
+}
+
+void Glulxe::build_tablecache() {
+	uint tablelen = Mem4(stringtable);
+	uint rootaddr = Mem4(stringtable + 8);
+
+	/* A table in RAM can be cached as well, as long as the cache is dropped
+	   whenever the table is written to. */
+	buildcache(&tablecache, rootaddr, CACHEBITS, 0);
+	/* dumpcache(&tablecache, 1, 0); */
+	tablecache_valid = true;
+	tablecache_stale = false;
+	tablecache_ramend = (stringtable + tablelen > ramstart) ? stringtable + tablelen : 0;
+}
+
+void Glulxe::drop_tablecache() {
+	int ix;
+
 	if (tablecache_valid) {
 		if (tablecache.type == 0)
 			dropcache(tablecache.u.branches);
 		tablecache.u.branches = nullptr;
 		tablecache_valid = false;
 	}
+	tablecache_ramend = 0;
+	tablecache_stale = false;
+
+	/* Decoded strings may depend on the table. */
+	for (ix = 0; ix < STRING_CACHE_SIZE; ix++) {
+		stringcache_t *entry = &stringcache[ix];
+		if (entry->chars)
+			glulx_free(entry->chars);
+		entry->addr = 0;
+		entry->len = 0;
+		entry->chars = nullptr;
+	}
+}
 
-	stringtable = addr;
+void Glulxe::stream_table_written() {
+	/* Rebuild the tables the next time a string is printed, rather than
+	   after every write. */
+	drop_tablecache();
+	tablecache_stale = true;
+}
+
+bool Glulxe::stream_cached_string(uint addr) {
+	stringcache_t *entry;
+	int ix;
+
+	if (!tablecache_valid || Mem1(addr) != 0xE1)
+		return false;
+
+	entry = &stringcache[addr & (STRING_CACHE_SIZE - 1)];
+	if (entry->addr != addr) {
+		if (entry->chars)
+			glulx_free(entry->chars);
+		entry->chars = nullptr;
+		entry->addr = addr;
+		if (!decode_cached_string(addr, entry))
+			entry->len = -1;
+	}
+
+	if (entry->len < 0)
+		return false;
+
+	/* Printing a character doesn't make Glk write to game memory, so the
+	   entry can't be dropped while it is replayed. */
+	for (ix = 0; ix < entry->len; ix++) {
+		uint32 ch = entry->chars[ix];
+		if (ch & STRING_CACHE_UNICODE)
+			(this->*glkio_unichar_han_ptr)(ch & ~STRING_CACHE_UNICODE);
+		else
+			glk_put_char(ch);
+	}
+
+	return true;
+}
 
-	if (stringtable) {
-		/* Build cache. We can only do this if the table is entirely in ROM. */
-		uint tablelen = Mem4(stringtable);
-		uint rootaddr = Mem4(stringtable + 8);
-		int cache_stringtable = (stringtable + tablelen <= ramstart);
-		/* cache_stringtable = true; ...for testing only */
-		/* cache_stringtable = false; ...for testing only */
-		if (cache_stringtable) {
-			buildcache(&tablecache, rootaddr, CACHEBITS, 0);
-			/* dumpcache(&tablecache, 1, 0); */
-			tablecache_valid = true;
+bool Glulxe::decode_cached_string(uint addr, stringcache_t *entry) {
+	uint32 buf[STRING_CACHE_MAXLEN];
+	int len = 0;
+	int bits, numbits, bitnum;
+	int readahead;
+	int ch;
+	uint tmpaddr, ival;
+	cacheblock_t *cablist;
+	int done = 0;
+
+	/* Skip the E1 type byte. */
+	addr++;
+	bitnum = 0;
+	bits = Mem1(addr);
+	numbits = 8;
+	readahead = false;
+
+	if (tablecache.type != 0) {
+		/* An empty string; see stream_string(). */
+		done = 1;
+	}
+
+	cablist = tablecache.u.branches;
+	while (!done) {
+		cacheblock_t *cab;
+
+		if (numbits < CACHEBITS) {
+			/* readahead is certainly false */
+			int newbyte = Mem1(addr + 1);
+			bits |= (newbyte << numbits);
+			numbits += 8;
+			readahead = true;
+		}
+
+		cab = &(cablist[bits & CACHEMASK]);
+		numbits -= cab->depth;
+		bits >>= cab->depth;
+		bitnum += cab->depth;
+		if (bitnum >= 8) {
+			addr += 1;
+			bitnum -= 8;
+			if (readahead) {
+				readahead = false;
+			} else {
+				int newbyte = Mem1(addr);
+				bits |= (newbyte << numbits);
+				numbits += 8;
+			}
+		}
+
+		switch (cab->type) {
+		case 0x00: /* non-leaf node */
+			cablist = cab->u.branches;
+			break;
+		case 0x01: /* string terminator */
+			done = 1;
+			break;
+		case 0x02: /* single character */
+			if (len >= STRING_CACHE_MAXLEN)
+				return false;
+			buf[len++] = cab->u.ch;
+			cablist = tablecache.u.branches;
+			break;
+		case 0x04: /* single Unicode character */
+			if (len >= STRING_CACHE_MAXLEN || (cab->u.uch & STRING_CACHE_UNICODE))
+				return false;
+			buf[len++] = cab->u.uch | STRING_CACHE_UNICODE;
+			cablist = tablecache.u.branches;
+			break;
+		case 0x03: /* C string */
+			for (tmpaddr = cab->u.addr; (ch = Mem1(tmpaddr)) != '\0'; tmpaddr++) {
+				if (len >= STRING_CACHE_MAXLEN)
+					return false;
+				buf[len++] = ch;
+			}
+			cablist = tablecache.u.branches;
+			break;
+		case 0x05: /* C Unicode string */
+			for (tmpaddr = cab->u.addr; (ival = Mem4(tmpaddr)) != 0; tmpaddr += 4) {
+				if (len >= STRING_CACHE_MAXLEN || (ival & STRING_CACHE_UNICODE))
+					return false;
+				buf[len++] = ival | STRING_CACHE_UNICODE;
+			}
+			cablist = tablecache.u.branches;
+			break;
+		default:
+			/* Indirect references have to be resolved as the string is
+			   printed. */
+			return false;
 		}
 	}
+
+	if (len) {
+		entry->chars = (uint32 *)glulx_malloc(len * sizeof(uint32));
+		if (!entry->chars)
+			return false;
+		memcpy(entry->chars, buf, len * sizeof(uint32));
+	}
+	entry->len = len;
+
+	return true;
 }
 
 void Glulxe::buildcache(cacheblock_t *cablist, uint nodeaddr, int depth, int mask) {
@@ -115,6 +115,10 @@ void Glulxe::finalize_vm() {
 		glulx_free(stack);
 		stack = nullptr;
 	}
+	if (decodecache) {
+		glulx_free(decodecache);
+		decodecache = nullptr;
+	}
 
 	final_serial();
 }
@@ -162,6 +166,9 @@ void Glulxe::vm_restart() {
 	pc = 0;
 	prevpc = 0;
 	stream_set_iosys(0, 0);
+	/* The string table may be in RAM, which has just been reloaded. */
+	if (tablecache_ramend)
+		stream_table_written();
 	stream_set_table(origstringtable);
 	valstackbase = 0;
 	localsbase = 0;
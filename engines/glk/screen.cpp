@@ -67,6 +67,14 @@ void Screen::fillRect(const Rect &box, uint color) {
 		Graphics::Screen::fillRect(box, color);
 }
 
+void Screen::scrollRect(const Rect &box, int dy) {
+	size_t rowSize = box.width() * format.bytesPerPixel;
+	for (int y = box.top; y < box.bottom - dy; y++)
+		memcpy(getBasePtr(box.left, y), getBasePtr(box.left, y + dy), rowSize);
+
+	addDirtyRect(box);
+}
+
 void Screen::loadFonts() {
 	Common::Archive *archive = nullptr;
 
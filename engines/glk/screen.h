@@ -91,6 +91,13 @@ public:
 	 */
 	void fillRect(const Rect &box, uint color);
 
+	/**
+	 * Moves the contents of a given area of the screen up
+	 * @param box       Area to scroll
+	 * @param dy        Number of pixels to move the contents by
+	 */
+	void scrollRect(const Rect &box, int dy);
+
 	/**
 	 * Draws a string using the specified font at the given co-ordinates
 	 * @param pos       Position for the bottom-left corner the text will be drawn with
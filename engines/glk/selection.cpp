@@ -128,6 +128,19 @@ void WindowMask::putHyperlink(uint linkval, uint x0, uint y0, uint x1, uint y1)
 	}
 }
 
+void WindowMask::scrollHyperlinks(uint x0, uint y0, uint x1, uint y1, uint dy) {
+	if (!_hor || !_ver || x1 >= _hor || y1 >= _ver || x0 >= x1 || y0 + dy >= y1)
+		return;
+
+	for (uint i = x0; i < x1; i++) {
+		if (!_links[i])
+			continue;
+
+		memmove(&_links[i][y0], &_links[i][y0 + dy], (y1 - y0 - dy) * sizeof(uint));
+		memset(&_links[i][y1 - dy], 0, dy * sizeof(uint));
+	}
+}
+
 uint WindowMask::getHyperlink(const Point &pos) const {
 	if (!_hor || !_ver) {
 		warning("getHyperlink: struct not initialized");
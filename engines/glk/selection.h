@@ -91,6 +91,11 @@ public:
 
 	void putHyperlink(uint linkval, uint x0, uint y0, uint x1, uint y1);
 
+	/**
+	 * Moves the hyperlinks within an area up by a given number of pixels
+	 */
+	void scrollHyperlinks(uint x0, uint y0, uint x1, uint y1, uint dy);
+
 	uint getHyperlink(const Point &pos) const;
 };
 
@@ -235,7 +235,9 @@ void TextBufferWindow::touchScroll() {
 	g_vm->_selection->clearSelection();
 	_windows->repaint(_bbox);
 
-	for (int i = 0; i < _scrollMax; i++)
+	// Rows are only skipped when redrawing the bottom of the text, so the ones
+	// further up the scrollback will be drawn anyway once scrolled to
+	for (int i = 0; i < _scrollMax && i < _height; i++)
 		_lines[i]._dirty = true;
 }
 
@@ -1080,7 +1082,7 @@ void TextBufferWindow::redraw() {
 	 * draw the images
 	 */
 	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+		const TextBufferRow &ln = _lines[i];
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1518,6 +1520,8 @@ bool TextBufferWindow::leftquote(uint32 c) {
 }
 
 void TextBufferWindow::scrollOneLine(bool forced) {
+	int oldScrollPos = _scrollPos;
+
 	_lastSeen++;
 	_scrollMax++;
 
@@ -1540,9 +1544,15 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
+	_lines.rotate();
+	_chars = _lines[0]._chars;
+	_attrs = _lines[0]._attrs;
+
+	// When the bottom of the text is shown before and after, the rows already drawn
+	// just move up a line, and only the previous bottom row needs drawing again
+	bool scrolled = oldScrollPos == 0 && _scrollPos == 0 && scrollRowPixels();
+	for (int i = 1; i < _height && i < _scrollBack; i++) {
+		if (i == 1 || !scrolled)
 			touch(i);
 	}
 
@@ -1556,6 +1566,7 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 		_ladjw = 0;
 
 	touch(0);
+	_lines[0]._repaint = false;
 	_lines[0]._len = 0;
 	_lines[0]._newLine = 0;
 	_lines[0]._lm = _ladjw;
@@ -1572,8 +1583,33 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 
 	_numChars = 0;
 
-	touchScroll();
+	if (scrolled) {
+		g_vm->_selection->clearSelection();
+		_windows->repaint(_bbox);
+	} else {
+		touchScroll();
+	}
+}
+
+bool TextBufferWindow::scrollRowPixels() {
+	Screen &screen = *g_vm->_screen;
+
+	if (Windows::_forceRedraw || _height < 2)
+		return false;
+
+	Rect box(_bbox.left + g_conf->_tMarginX, _bbox.top + g_conf->_tMarginY,
+		_bbox.right - g_conf->_tMarginX - g_conf->_scrollWidth,
+		_bbox.top + g_conf->_tMarginY + _height * _font._leading);
+	if (box.left < 0 || box.top < 0 || box.right > screen.w || box.bottom > screen.h
+			|| box.width() <= 0 || box.height() <= _font._leading)
+		return false;
+
+	screen.scrollRect(box, _font._leading);
 
+	// Hyperlinks in the rows which aren't redrawn have to follow the text
+	g_vm->_selection->scrollHyperlinks(box.left, box.top, box.right, box.bottom, _font._leading);
+
+	return true;
 }
 
 void TextBufferWindow::scrollResize() {
@@ -1636,6 +1672,23 @@ void TextBufferWindow::flowBreak() {
 
 /*--------------------------------------------------------------------------*/
 
+void TextBufferWindow::TextBufferRows::resize(uint newSize) {
+	if (_head != 0) {
+		// Put the rows back in order before any are added at the top
+		Common::Array<TextBufferRow> rows;
+		rows.reserve(newSize);
+		for (uint idx = 0; idx < _rows.size(); ++idx)
+			rows.push_back((*this)[idx]);
+
+		_rows = rows;
+		_head = 0;
+	}
+
+	_rows.resize(newSize);
+}
+
+/*--------------------------------------------------------------------------*/
+
 TextBufferWindow::TextBufferRow::TextBufferRow() : _len(0), _newLine(0), _dirty(false),
 	_repaint(false), _lPic(nullptr), _rPic(nullptr), _lHyper(0), _rHyper(0),
 	_lm(0), _rm(0) {
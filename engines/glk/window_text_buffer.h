@@ -53,12 +53,50 @@ class TextBufferWindow : public TextWindow, Speech {
 		 */
 		TextBufferRow();
 	};
-	typedef Common::Array<TextBufferRow> TextBufferRows;
+
+	/**
+	 * The rows of the window and its scrollback, indexed from the bottom row upwards.
+	 * Scrolling rotates the rows rather than copying every one of them up by one
+	 */
+	class TextBufferRows {
+	private:
+		Common::Array<TextBufferRow> _rows;
+		uint _head;     ///< Index in _rows of the bottom row
+	public:
+		TextBufferRows() : _head(0) {}
+
+		TextBufferRow &operator[](uint idx) {
+			idx += _head;
+			return _rows[idx >= _rows.size() ? idx - _rows.size() : idx];
+		}
+
+		uint size() const { return _rows.size(); }
+
+		void clear() {
+			_rows.clear();
+			_head = 0;
+		}
+
+		void resize(uint newSize);
+
+		/**
+		 * Moves every row up by one. The top row wraps around to become the bottom row
+		 */
+		void rotate() {
+			_head = (_head == 0) ? _rows.size() - 1 : _head - 1;
+		}
+	};
 private:
 	PropFontInfo &_font;
 private:
 	void reflow();
 	void touchScroll();
+
+	/**
+	 * Moves the text already drawn on screen up by one line
+	 * @returns     False if it can't, and the rows have to be redrawn instead
+	 */
+	bool scrollRowPixels();
 	bool putPicture(Picture *pic, uint align, uint linkval);
 
 	/**
@@ -163,6 +163,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -379,6 +380,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows statistics about the garbage collections run so far\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -2829,6 +2831,22 @@ bool Console::cmdGCNormalize(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	const GCStatistics &stats = _engine->_gamestate->gcStats;
+
+	debugPrintf("Collections: %u, periodic collections skipped: %u\n", stats.runs, stats.skipped);
+	debugPrintf("Collectable changes since the last collection: %s\n", _engine->_gamestate->_segMan->isGCPending() ? "yes" : "no");
+	if (!stats.runs)
+		return true;
+
+	debugPrintf("Pause time: last %u ms, max %u ms, average %u ms\n",
+			stats.lastPause, stats.maxPause, stats.totalPause / stats.runs);
+	debugPrintf("Last collection: %u addresses reachable, %u freed\n", stats.lastReachable, stats.lastFreed);
+	debugPrintf("Freed in total: %u\n", stats.totalFreed);
+
+	return true;
+}
+
 bool Console::cmdVMVarlist(int argc, const char **argv) {
 	EngineState *s = _engine->_gamestate;
 	const char *varnames[] = {"global", "local", "temp", "param"};
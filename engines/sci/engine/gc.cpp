@@ -22,6 +22,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -181,6 +182,10 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 
 void run_gc(EngineState *s) {
 	SegManager *segMan = s->_segMan;
+	const uint32 startTime = g_system->getMillis();
+	uint32 freed = 0;
+
+	segMan->clearGCPending();
 
 	// Some debug stuff
 	debugC(kDebugLevelGC, "[GC] Running...");
@@ -215,6 +220,7 @@ void run_gc(EngineState *s) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
+					freed++;
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
 #endif
@@ -224,8 +230,19 @@ void run_gc(EngineState *s) {
 		}
 	}
 
+	GCStatistics &stats = s->gcStats;
+	stats.runs++;
+	stats.lastPause = g_system->getMillis() - startTime;
+	stats.maxPause = MAX(stats.maxPause, stats.lastPause);
+	stats.totalPause += stats.lastPause;
+	stats.lastReachable = activeRefs->size();
+	stats.lastFreed = freed;
+	stats.totalFreed += freed;
+
 	delete activeRefs;
 
+	debugC(kDebugLevelGC, "[GC] Freed %u addresses in %u ms, %u reachable", freed, stats.lastPause, stats.lastReachable);
+
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
 	debugC(kDebugLevelGC, "[GC] Summary:");
@@ -34,6 +34,7 @@
 #include "sci/graphics/frameout.h"
 #endif
 
+#include "common/array.h"
 #include "common/debug-channels.h"
 #include "common/list.h"
 #include "common/system.h"
@@ -117,10 +118,16 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// A* set membership
+	bool inOpenSet;
+	bool inClosedSet;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = NULL;
+		inOpenSet = false;
+		inClosedSet = false;
 	}
 };
 
@@ -699,13 +706,50 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 	return 0;
 }
 
+// Polygon edge with its bounding box
+struct EdgeBounds {
+	Vertex *edge;
+	int16 left, top, right, bottom;
+};
+
+typedef Common::Array<EdgeBounds> EdgeBoundsList;
+
+/**
+ * Collects the edges of all polygons along with their bounding boxes.
+ * Parameters: (PathfindingState *) s: The pathfinding state
+ *             (EdgeBoundsList &) edges: The list to fill
+ */
+static void collect_edges(PathfindingState *s, EdgeBoundsList &edges) {
+	edges.clear();
+	edges.reserve(s->vertices);
+
+	for (int i = 0; i < s->vertices; i++) {
+		Vertex *edge = s->vertex_index[i];
+
+		if (!VERTEX_HAS_EDGES(edge))
+			continue;
+
+		const Common::Point &p = edge->v;
+		const Common::Point &q = CLIST_NEXT(edge)->v;
+
+		EdgeBounds bounds;
+		bounds.edge = edge;
+		bounds.left = MIN(p.x, q.x);
+		bounds.top = MIN(p.y, q.y);
+		bounds.right = MAX(p.x, q.x);
+		bounds.bottom = MAX(p.y, q.y);
+		edges.push_back(bounds);
+	}
+}
+
 /**
  * Returns a list of all vertices that are visible from a particular vertex.
  * @param s				the pathfinding state
+ * @param edges			the polygon edges, as returned by collect_edges
  * @param vertex_cur	the vertex
  * @return list of vertices that are visible from vert
  */
-static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
+static VertexList *visible_vertices(PathfindingState *s, const EdgeBoundsList &edges, Vertex *vertex_cur) {
 	VertexList *visVerts = new VertexList();
 
 	for (int i = 0; i < s->vertices; i++) {
@@ -715,26 +759,37 @@ static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
 			continue;
 
+		// An edge can only block the line of sight if its bounding box
+		// overlaps the one of the line of sight. between() doesn't honor
+		// that for coinciding points, so those always check all edges.
+		const bool cull = (vertex_cur->v != vertex->v);
+		const int16 left = MIN(vertex_cur->v.x, vertex->v.x);
+		const int16 top = MIN(vertex_cur->v.y, vertex->v.y);
+		const int16 right = MAX(vertex_cur->v.x, vertex->v.x);
+		const int16 bottom = MAX(vertex_cur->v.y, vertex->v.y);
+
 		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
-
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
+		uint j;
+		for (j = 0; j < edges.size(); j++) {
+			const EdgeBounds &bounds = edges[j];
+			if (cull && (bounds.left > right || bounds.right < left || bounds.top > bottom || bounds.bottom < top))
+				continue;
 
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+			Vertex *edge = bounds.edge;
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
 					break;
+
+				// This edge won't properly intersect, so we continue
+				continue;
 			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				break;
 		}
 
-		if (j == s->vertices)
+		if (j == edges.size())
 			visVerts->push_front(vertex);
 	}
 
@@ -1356,13 +1411,42 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
  * Parameters: (PathfindingState *) s: The pathfinding state
  */
 static void AStar(PathfindingState *s) {
-	// Vertices of which the shortest path is known
-	VertexList closedSet;
-
-	// The remaining vertices
+	// The remaining vertices. Vertices of which the shortest path is
+	// known are flagged with inClosedSet.
 	VertexList openSet;
 
+	EdgeBoundsList edges;
+	collect_edges(s, edges);
+
+	// When travelling to a vertex on the screen edge, we
+	// add a penalty score to make this path less appealing.
+	// NOTE: If an obstacle has only one vertex on a screen edge,
+	// later SSCI pathfinders will treat that vertex like any
+	// other, while we apply a penalty to paths traversing it.
+	// This difference might lead to problems, but none are
+	// known at the time of writing.
+
+	// WORKAROUND: This check is needed in SCI1.1 games, such as LB2. Until our
+	// algorithm matches better what SSCI is doing, we exempt certain rooms where
+	// the check fails.
+	const bool penaltyWorkaround =
+		// QFG1VGA room 81 - Hero gets stuck when walking to the SE corner (bug #6140).
+		(g_sci->getGameId() == GID_QFG1VGA && g_sci->getEngineState()->currentRoomNumber() == 81) ||
+#ifdef ENABLE_SCI32
+		// QFG4 room 563 - Hero zig-zags into the room (bug #10858).
+		// Entering from the south (564) off-screen behind an obstacle, hero
+		// fails to turn at a point on the screen edge, passes the poly's corner,
+		// then approaches the destination from deeper in the room.
+		(g_sci->getGameId() == GID_QFG4 && g_sci->getEngineState()->currentRoomNumber() == 563) ||
+
+		// QFG4 room 580 - Hero zig-zags into the room (bug #10870).
+		// Entering from the south (581) off-screen behind an obstacle, as above.
+		(g_sci->getGameId() == GID_QFG4 && g_sci->getEngineState()->currentRoomNumber() == 580) ||
+#endif
+		false;
+
 	openSet.push_front(s->vertex_start);
+	s->vertex_start->inOpenSet = true;
 	s->vertex_start->costG = 0;
 	s->vertex_start->costF = (uint32)sqrt((float)s->vertex_start->v.sqrDist(s->vertex_end->v));
 
@@ -1388,50 +1472,26 @@ static void AStar(PathfindingState *s) {
 			break;
 
 		// Move vertex from set open to set closed
-		closedSet.push_front(vertex_min);
+		vertex_min->inOpenSet = false;
+		vertex_min->inClosedSet = true;
 		openSet.erase(vertex_min_it);
 
-		VertexList *visVerts = visible_vertices(s, vertex_min);
+		VertexList *visVerts = visible_vertices(s, edges, vertex_min);
 
 		for (VertexList::iterator it = visVerts->begin(); it != visVerts->end(); ++it) {
 			uint32 new_dist;
 			Vertex *vertex = *it;
 
-			if (closedSet.contains(vertex))
+			if (vertex->inClosedSet)
 				continue;
 
-			if (!openSet.contains(vertex))
+			if (!vertex->inOpenSet) {
 				openSet.push_front(vertex);
+				vertex->inOpenSet = true;
+			}
 
 			new_dist = vertex_min->costG + (uint32)sqrt((float)vertex_min->v.sqrDist(vertex->v));
 
-			// When travelling to a vertex on the screen edge, we
-			// add a penalty score to make this path less appealing.
-			// NOTE: If an obstacle has only one vertex on a screen edge,
-			// later SSCI pathfinders will treat that vertex like any
-			// other, while we apply a penalty to paths traversing it.
-			// This difference might lead to problems, but none are
-			// known at the time of writing.
-
-			// WORKAROUND: This check is needed in SCI1.1 games, such as LB2. Until our
-			// algorithm matches better what SSCI is doing, we exempt certain rooms where
-			// the check fails.
-			bool penaltyWorkaround =
-				// QFG1VGA room 81 - Hero gets stuck when walking to the SE corner (bug #6140).
-				(g_sci->getGameId() == GID_QFG1VGA && g_sci->getEngineState()->currentRoomNumber() == 81) ||
-#ifdef ENABLE_SCI32
-				// QFG4 room 563 - Hero zig-zags into the room (bug #10858).
-				// Entering from the south (564) off-screen behind an obstacle, hero
-				// fails to turn at a point on the screen edge, passes the poly's corner,
-				// then approaches the destination from deeper in the room.
-				(g_sci->getGameId() == GID_QFG4 && g_sci->getEngineState()->currentRoomNumber() == 563) ||
-
-				// QFG4 room 580 - Hero zig-zags into the room (bug #10870).
-				// Entering from the south (581) off-screen behind an obstacle, as above.
-				(g_sci->getGameId() == GID_QFG4 && g_sci->getEngineState()->currentRoomNumber() == 580) ||
-#endif
-				false;
-
 			if (s->pointOnScreenBorder(vertex->v) && !penaltyWorkaround)
 				new_dist += 10000;
 
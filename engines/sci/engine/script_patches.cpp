@@ -30,6 +30,7 @@
 #include "sci/engine/guest_additions.h"
 #endif
 
+#include "common/algorithm.h"
 #include "common/util.h"
 
 namespace Sci {
@@ -18355,6 +18356,61 @@ int32 ScriptPatcher::findSignature(const SciScriptPatcherEntry *patchEntry, cons
 	return findSignature(runtimeEntry->magicDWord, runtimeEntry->magicOffset, patchEntry->signatureData, patchEntry->description, scriptData);
 }
 
+static inline uint magicDWordFilterBit(uint32 magicDWord) {
+	return (magicDWord * 2654435761U) >> 22;
+}
+
+void ScriptPatcher::indexMagicDWords(const SciSpan<const byte> &scriptData) {
+	memset(_magicDWordFilter, 0, sizeof(_magicDWordFilter));
+	for (uint i = 0; i < _magicDWords.size(); i++) {
+		const uint bit = magicDWordFilterBit(_magicDWords[i]);
+		_magicDWordFilter[bit >> 5] |= 1U << (bit & 31);
+	}
+
+	_magicDWordOffsets.resize(_magicDWords.size());
+	for (uint i = 0; i < _magicDWordOffsets.size(); i++)
+		_magicDWordOffsets[i].clear();
+
+	if (scriptData.size() < 4) // we need to find a DWORD, so less than 4 bytes is not okay
+		return;
+
+	const uint32 searchLimit = scriptData.size() - 3;
+	const byte *data = scriptData.getUnsafeDataAt(0, scriptData.size());
+	for (uint32 DWordOffset = 0; DWordOffset < searchLimit; DWordOffset++) {
+		// magic DWords are in platform-specific BE/LE form, see findSignature()
+		const uint32 DWord = READ_UINT32(data + DWordOffset);
+		const uint bit = magicDWordFilterBit(DWord);
+		if (!(_magicDWordFilter[bit >> 5] & (1U << (bit & 31))))
+			continue;
+
+		for (uint i = 0; i < _magicDWords.size(); i++) {
+			if (_magicDWords[i] == DWord) {
+				_magicDWordOffsets[i].push_back(DWordOffset);
+				break;
+			}
+		}
+	}
+}
+
+int32 ScriptPatcher::findIndexedSignature(const SciScriptPatcherEntry *patchEntry, const SciScriptPatcherRuntimeEntry *runtimeEntry, const SciSpan<const byte> &scriptData) {
+	for (uint i = 0; i < _magicDWords.size(); i++) {
+		if (_magicDWords[i] != runtimeEntry->magicDWord)
+			continue;
+
+		// The offsets are in ascending order, so this finds the same match as findSignature()
+		const Common::Array<uint32> &offsets = _magicDWordOffsets[i];
+		for (uint j = 0; j < offsets.size(); j++) {
+			const uint32 offset = offsets[j] + runtimeEntry->magicOffset;
+
+			if (verifySignature(offset, patchEntry->signatureData, patchEntry->description, scriptData))
+				return offset;
+		}
+		break;
+	}
+	// nothing found
+	return -1;
+}
+
 // Attention: Magic DWord is returned using platform specific byte order. This is done on purpose for performance.
 void ScriptPatcher::calculateMagicDWordAndVerify(const char *signatureDescription, const uint16 *signatureData, bool magicDWordIncluded, uint32 &calculatedMagicDWord, int &calculatedMagicDWordOffset) {
 	Selector curSelector = -1;
@@ -18786,6 +18842,25 @@ void ScriptPatcher::processScript(uint16 scriptNr, SciSpan<byte> scriptData) {
 			}
 		}
 
+		// Collect the magic DWords of all active patches for this script
+		_magicDWords.clear();
+		curEntry = signatureTable;
+		curRuntimeEntry = _runtimeTable;
+
+		while (curEntry->signatureData) {
+			if ((scriptNr == curEntry->scriptNr) && (curRuntimeEntry->active)) {
+				if (Common::find(_magicDWords.begin(), _magicDWords.end(), curRuntimeEntry->magicDWord) == _magicDWords.end())
+					_magicDWords.push_back(curRuntimeEntry->magicDWord);
+			}
+			curEntry++; curRuntimeEntry++;
+		}
+
+		if (_magicDWords.empty())
+			return;
+
+		// Scan the script once for all of them
+		indexMagicDWords(scriptData);
+
 		curEntry = signatureTable;
 		curRuntimeEntry = _runtimeTable;
 
@@ -18794,11 +18869,14 @@ void ScriptPatcher::processScript(uint16 scriptNr, SciSpan<byte> scriptData) {
 				int32 foundOffset = 0;
 				int16 applyCount = curEntry->applyCount;
 				do {
-					foundOffset = findSignature(curEntry, curRuntimeEntry, scriptData);
+					foundOffset = findIndexedSignature(curEntry, curRuntimeEntry, scriptData);
 					if (foundOffset != -1) {
 						// found, so apply the patch
 						debugC(kDebugLevelScriptPatcher, "Script-Patcher: '%s' on script %d offset %d", curEntry->description, scriptNr, foundOffset);
 						applyPatch(curEntry, scriptData, foundOffset);
+
+						// The patch changed the script data, so the offsets have to be collected again
+						indexMagicDWords(scriptData);
 					}
 					applyCount--;
 				} while ((foundOffset != -1) && (applyCount));
@@ -23,6 +23,7 @@
 #ifndef SCI_ENGINE_SCRIPT_PATCHES_H
 #define SCI_ENGINE_SCRIPT_PATCHES_H
 
+#include "common/array.h"
 #include "sci/sci.h"
 
 namespace Sci {
@@ -120,9 +121,22 @@ private:
 	// Applies a patch to a given script + offset (overwrites parts)
 	void applyPatch(const SciScriptPatcherEntry *patchEntry, SciSpan<byte> scriptData, int32 signatureOffset);
 
+	// Collects the offsets of all magic DWords in _magicDWords inside script data,
+	// so that the script only has to be scanned once for all patches
+	void indexMagicDWords(const SciSpan<const byte> &scriptData);
+
+	// Same as findSignature(), but only checks the offsets found by indexMagicDWords()
+	int32 findIndexedSignature(const SciScriptPatcherEntry *patchEntry, const SciScriptPatcherRuntimeEntry *runtimeEntry, const SciSpan<const byte> &scriptData);
+
 	Selector *_selectorIdTable;
 	SciScriptPatcherRuntimeEntry *_runtimeTable;
 	bool _isMacSci11;
+
+	// Magic DWords of the active patches for the script currently processed,
+	// the offsets where each one occurs, and a bit filter to quickly skip others
+	Common::Array<uint32> _magicDWords;
+	Common::Array<Common::Array<uint32> > _magicDWordOffsets;
+	uint32 _magicDWordFilter[32];
 };
 
 } // End of namespace Sci
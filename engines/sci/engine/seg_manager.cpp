@@ -30,11 +30,25 @@
 
 namespace Sci {
 
+void SelectorLookupCache::flush() {
+	if (_hits || _misses)
+		debugC(kDebugLevelVM, "Flushing selector lookup cache: %u hits, %u misses", _hits, _misses);
+
+	for (uint i = 0; i < kCacheSize; i++) {
+		_entries[i].object = NULL_REG;
+		_entries[i].selector = -1;
+	}
+
+	_hits = 0;
+	_misses = 0;
+}
 
 SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 	: _resMan(resMan), _scriptPatcher(scriptPatcher) {
 	_heap.push_back(0);
 
+	_gcPending = true;
+
 	_clonesSegId = 0;
 	_listsSegId = 0;
 	_nodesSegId = 0;
@@ -67,6 +81,8 @@ void SegManager::resetSegMan() {
 	// And reinitialize
 	_heap.push_back(0);
 
+	_gcPending = true;
+
 	_clonesSegId = 0;
 	_listsSegId = 0;
 	_nodesSegId = 0;
@@ -80,6 +96,8 @@ void SegManager::resetSegMan() {
 	// Reinitialize class table
 	_classTable.clear();
 	createClassTable();
+
+	_selectorLookupCache.flush();
 }
 
 void SegManager::initSysStrings() {
@@ -167,6 +185,7 @@ void SegManager::deallocate(SegmentId seg) {
 	if (mobj->getType() == SEG_TYPE_SCRIPT) {
 		Script *scr = (Script *)mobj;
 		_scriptSegMap.erase(scr->getScriptNumber());
+		_selectorLookupCache.flush();
 		if (scr->getLocalsSegment()) {
 			// Check if the locals segment has already been deallocated.
 			// If the locals block has been stored in a segment with an ID
@@ -403,6 +422,7 @@ reg_t SegManager::allocateHunkEntry(const char *hunk_type, int size) {
 	table = (HunkTable *)_heap[_hunksSegId];
 
 	offset = table->allocEntry();
+	_gcPending = true;
 
 	reg_t addr = make_reg(_hunksSegId, offset);
 	Hunk *h = &table->at(offset);
@@ -438,6 +458,7 @@ Clone *SegManager::allocateClone(reg_t *addr) {
 		table = (CloneTable *)_heap[_clonesSegId];
 
 	offset = table->allocEntry();
+	_gcPending = true;
 
 	*addr = make_reg(_clonesSegId, offset);
 	return &table->at(offset);
@@ -452,6 +473,7 @@ List *SegManager::allocateList(reg_t *addr) {
 	table = (ListTable *)_heap[_listsSegId];
 
 	offset = table->allocEntry();
+	_gcPending = true;
 
 	*addr = make_reg(_listsSegId, offset);
 	return &table->at(offset);
@@ -466,6 +488,7 @@ Node *SegManager::allocateNode(reg_t *addr) {
 	table = (NodeTable *)_heap[_nodesSegId];
 
 	offset = table->allocEntry();
+	_gcPending = true;
 
 	*addr = make_reg(_nodesSegId, offset);
 	return &table->at(offset);
@@ -850,6 +873,7 @@ Common::String SegManager::getString(reg_t pointer) {
 byte *SegManager::allocDynmem(int size, const char *descr, reg_t *addr) {
 	SegmentId seg;
 	SegmentObj *mobj = allocSegment(new DynMem(), &seg);
+	_gcPending = true;
 	*addr = make_reg(seg, 0);
 
 	DynMem &d = *(DynMem *)mobj;
@@ -893,6 +917,7 @@ SciArray *SegManager::allocateArray(SciArrayType type, uint16 size, reg_t *addr)
 		table = (ArrayTable *)_heap[_arraysSegId];
 
 	offset = table->allocEntry();
+	_gcPending = true;
 
 	*addr = make_reg(_arraysSegId, offset);
 
@@ -949,6 +974,7 @@ SciBitmap *SegManager::allocateBitmap(reg_t *addr, const int16 width, const int1
 	}
 
 	offset = table->allocEntry();
+	_gcPending = true;
 
 	*addr = make_reg(_bitmapSegId, offset);
 	SciBitmap &bitmap = table->at(offset);
@@ -1050,6 +1076,10 @@ int SegManager::instantiateScript(int scriptNum, bool applyScriptPatches) {
 	g_sci->_guestAdditions->instantiateScriptHook(*scr);
 #endif
 
+	// The new objects may reuse the addresses of objects of a previously
+	// freed script
+	_selectorLookupCache.flush();
+
 	return segmentId;
 }
 
@@ -1068,6 +1098,10 @@ void SegManager::uninstantiateScript(int script_nr) {
 	if (scr->getLockers() > 0)
 		return;
 
+	// The script's objects are no longer part of the garbage collector's
+	// root set
+	_gcPending = true;
+
 	// Free all classtable references to this script
 	for (uint i = 0; i < classTableSize(); i++)
 		if (getClass(i).reg.getSegment() == segmentId)
@@ -46,6 +46,67 @@ enum ScriptLoadType {
 
 class Script;
 
+/**
+ * Cache of the results of lookupSelector().
+ *
+ * Entries are keyed on the position of the object in its script, which clones
+ * share with the object they were cloned from. Clones copy the methods and
+ * the superclass of their source, so they resolve all selectors the same way.
+ * The cache has to be flushed whenever scripts are loaded or freed.
+ */
+class SelectorLookupCache {
+public:
+	struct Entry {
+		reg_t object;
+		Selector selector;
+		SelectorType type;
+		int varIndex;
+		reg_t function;
+	};
+
+	SelectorLookupCache() : _hits(0), _misses(0) { flush(); }
+
+	/**
+	 * Look up a selector of an object.
+	 * @return The cached result, or nullptr if the selector is not cached
+	 */
+	const Entry *find(reg_t object, Selector selector) {
+		const Entry &entry = _entries[hash(object, selector)];
+		if (entry.object == object && entry.selector == selector) {
+			_hits++;
+			return &entry;
+		}
+
+		_misses++;
+		return nullptr;
+	}
+
+	void store(reg_t object, Selector selector, SelectorType type, int varIndex, reg_t function) {
+		Entry &entry = _entries[hash(object, selector)];
+		entry.object = object;
+		entry.selector = selector;
+		entry.type = type;
+		entry.varIndex = varIndex;
+		entry.function = function;
+	}
+
+	void flush();
+
+private:
+	enum {
+		kCacheSize = 1024
+	};
+
+	static uint hash(reg_t object, Selector selector) {
+		return (object.getSegment() * 613 + object.getOffset() * 31 + selector) & (kCacheSize - 1);
+	}
+
+	Entry _entries[kCacheSize];
+
+	uint32 _hits;
+	uint32 _misses;
+};
+
 class SegManager : public Common::Serializable {
 	friend class Console;
 public:
@@ -458,6 +519,17 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	SelectorLookupCache &getSelectorLookupCache() { return _selectorLookupCache; }
+
+	/**
+	 * Checks whether anything the garbage collector can free has been
+	 * allocated, or a script has been uninstantiated, since the last call to
+	 * clearGCPending(). If not, the heap can't have grown in the meantime, so
+	 * a periodic collection may be deferred.
+	 */
+	bool isGCPending() const { return _gcPending; }
+	void clearGCPending() { _gcPending = false; }
+
 private:
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
@@ -467,6 +539,10 @@ private:
 	ResourceManager *_resMan;
 	ScriptPatcher *_scriptPatcher;
 
+	SelectorLookupCache _selectorLookupCache;
+
+	bool _gcPending;
+
 	SegmentId _clonesSegId; ///< ID of the (a) clones segment
 	SegmentId _listsSegId; ///< ID of the (a) list segment
 	SegmentId _nodesSegId; ///< ID of the (a) node segment
@@ -327,6 +327,20 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x, %s", PRINT_REG(obj_location), origin.toString().c_str());
 	}
 
+	SelectorLookupCache &cache = segMan->getSelectorLookupCache();
+	const reg_t objPos = obj->getPos();
+	const SelectorLookupCache::Entry *cached = cache.find(objPos, selectorId);
+
+	if (cached) {
+		if (cached->type == kSelectorVariable && varp) {
+			varp->obj = obj_location;
+			varp->varindex = cached->varIndex;
+		} else if (cached->type == kSelectorMethod && fptr) {
+			*fptr = cached->function;
+		}
+		return cached->type;
+	}
+
 	index = obj->locateVarSelector(segMan, selectorId);
 
 	if (index >= 0) {
@@ -335,21 +349,25 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 			varp->obj = obj_location;
 			varp->varindex = index;
 		}
+		cache.store(objPos, selectorId, kSelectorVariable, index, NULL_REG);
 		return kSelectorVariable;
 	} else {
 		// Check if it's a method, with recursive lookup in superclasses
 		while (obj) {
 			index = obj->funcSelectorPosition(selectorId);
 			if (index >= 0) {
+				const reg_t function = obj->getFunction(index);
 				if (fptr)
-					*fptr = obj->getFunction(index);
+					*fptr = function;
 
+				cache.store(objPos, selectorId, kSelectorMethod, -1, function);
 				return kSelectorMethod;
 			} else {
 				obj = segMan->getObject(obj->getSuperClassSelector());
 			}
 		}
 
+		cache.store(objPos, selectorId, kSelectorNone, -1, NULL_REG);
 		return kSelectorNone;
 	}
 
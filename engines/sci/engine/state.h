@@ -98,6 +98,28 @@ struct SciCallOrigin {
 	}
 };
 
+/**
+ * Statistics about the garbage collections run so far, for the debugger.
+ */
+struct GCStatistics {
+	uint32 runs; ///< Number of collections
+	uint32 skipped; ///< Number of periodic collections skipped since nothing new could be collected
+	uint32 lastPause; ///< Duration of the last collection in ms
+	uint32 maxPause; ///< Duration of the longest collection in ms
+	uint32 totalPause; ///< Duration of all collections in ms
+	uint32 lastReachable; ///< Number of addresses found reachable by the last collection
+	uint32 lastFreed; ///< Number of addresses freed by the last collection
+	uint32 totalFreed; ///< Number of addresses freed by all collections
+
+	GCStatistics() { reset(); }
+
+	void reset() {
+		runs = skipped = 0;
+		lastPause = maxPause = totalPause = 0;
+		lastReachable = lastFreed = totalFreed = 0;
+	}
+};
+
 struct EngineState : public Common::Serializable {
 public:
 	EngineState(SegManager *segMan);
@@ -190,6 +212,7 @@ public:
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	GCStatistics gcStats;
 
 	MessageState *_msgState;
 
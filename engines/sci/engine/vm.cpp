@@ -634,7 +634,10 @@ void run_vm(EngineState *s) {
 		if (s->abortScriptProcessing != kAbortNone)
 			return; // Stop processing
 
-		g_sci->checkAddressBreakpoint(s->xs->addr.pc);
+		// The debugger checks are done for every instruction, so only call
+		// into the debugger when it has something to do
+		if (g_sci->_debugState._activeBreakpointTypes & BREAK_ADDRESS)
+			g_sci->checkAddressBreakpoint(s->xs->addr.pc);
 
 		// Debug if this has been requested:
 		// TODO: re-implement sci_debug_flags
@@ -643,7 +646,8 @@ void run_vm(EngineState *s) {
 			g_sci->_debugState.breakpointWasHit = false;
 		}
 		Console *con = g_sci->getSciDebugger();
-		con->onFrame();
+		if (con->isAttached())
+			con->onFrame();
 
 		if (s->xs->sp < s->xs->fp)
 			error("run_vm(): stack underflow, sp: %04x:%04x, fp: %04x:%04x",
@@ -883,7 +887,10 @@ void run_vm(EngineState *s) {
 			// Run the garbage collector, if needed
 			if (s->gcCountDown-- <= 0) {
 				s->gcCountDown = s->scriptGCInterval;
-				run_gc(s);
+				if (s->_segMan->isGCPending())
+					run_gc(s);
+				else
+					s->gcStats.skipped++;
 			}
 
 			// Call kernel function
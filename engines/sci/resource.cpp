@@ -22,6 +22,7 @@
 
 // Resource library
 
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
@@ -969,7 +970,11 @@ ResourceManager::ResourceManager(const bool detectionMode) :
 	_detectionMode(detectionMode) {}
 
 void ResourceManager::init() {
+#ifdef LOW_MEMORY_DEVICE
 	_maxMemoryLRU = 256 * 1024; // 256KiB
+#else
+	_maxMemoryLRU = 1024 * 1024; // 1MiB
+#endif
 	_memoryLocked = 0;
 	_memoryLRU = 0;
 	_LRU.clear();
@@ -1029,9 +1034,19 @@ void ResourceManager::init() {
 	// cache, leading to constant decompression of picture resources
 	// and making the renderer very slow.
 	if (getSciVersion() >= SCI_VERSION_2) {
+#ifdef LOW_MEMORY_DEVICE
 		_maxMemoryLRU = 4096 * 1024; // 4MiB
+#else
+		_maxMemoryLRU = 32768 * 1024; // 32MiB
+#endif
 	}
 
+	// 0 keeps the budget above. Anything else is kept within 256KiB and 1GiB,
+	// as a smaller cache would thrash and a larger one overflow the counters.
+	const int cacheSize = ConfMan.getInt("resource_cache_size");
+	if (cacheSize != 0)
+		_maxMemoryLRU = CLIP<int>(cacheSize, 256, 1024 * 1024) * 1024;
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -1078,7 +1093,7 @@ void ResourceManager::removeFromLRU(Resource *res) {
 		warning("resMan: trying to remove resource that isn't enqueued");
 		return;
 	}
-	_LRU.remove(res);
+	_LRU.erase(res->_lruPosition);
 	_memoryLRU -= res->size();
 	res->_status = kResStatusAllocated;
 }
@@ -1089,6 +1104,7 @@ void ResourceManager::addToLRU(Resource *res) {
 		return;
 	}
 	_LRU.push_front(res);
+	res->_lruPosition = _LRU.begin();
 	_memoryLRU += res->size();
 #if SCI_VERBOSE_RESMAN
 	debug("Adding %s (%d bytes) to lru control: %d bytes total",
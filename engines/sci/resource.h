@@ -76,7 +76,11 @@ enum ResourceErrorCodes {
 };
 
 enum {
+#ifdef LOW_MEMORY_DEVICE
 	MAX_OPENED_VOLUMES = 5 ///< Max number of simultaneously opened volumes
+#else
+	MAX_OPENED_VOLUMES = 16 ///< Max number of simultaneously opened volumes
+#endif
 };
 
 enum ResourceType {
@@ -296,6 +300,7 @@ protected:
 	int32 _fileOffset; /**< Offset in file */
 	ResourceStatus _status;
 	uint16 _lockers; /**< Number of places where this resource was locked */
+	Common::List<Resource *>::iterator _lruPosition; /**< Position in the LRU list, if enqueued */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
@@ -472,6 +477,7 @@ protected:
 	// Note: maxMemory will not be interpreted as a hard limit, only as a restriction
 	// for resources which are not explicitly locked. However, a warning will be
 	// issued whenever this limit is exceeded.
+	// The "resource_cache_size" config key overrides this, in KiB (see README).
 	int _maxMemoryLRU;
 
 	ViewType _viewType; // Used to determine if the game has EGA or VGA graphics
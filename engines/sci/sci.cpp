@@ -88,6 +88,8 @@ SciEngine::SciEngine(OSystem *syst, const ADGameDescription *desc, SciGameId gam
 	assert(g_sci == 0);
 	g_sci = this;
 
+	ConfMan.registerDefault("resource_cache_size", 0);
+
 	_gfxMacIconBar = 0;
 
 	_audio = 0;
@@ -734,11 +736,6 @@ GUI::Debugger *SciEngine::getDebugger() {
 	return _console;
 }
 
-// Used to obtain the engine's console in order to print messages to it
-Console *SciEngine::getSciDebugger() {
-	return _console;
-}
-
 const char *SciEngine::getGameIdStr() const {
 	return _gameDescription->gameId;
 }
@@ -258,7 +258,8 @@ public:
 	bool hasFeature(EngineFeature f) const;
 	void pauseEngineIntern(bool pause);
 	virtual GUI::Debugger *getDebugger();
-	Console *getSciDebugger();
+	// Used to obtain the engine's console in order to print messages to it
+	Console *getSciDebugger() { return _console; }
 	Common::Error loadGameState(int slot);
 	Common::Error saveGameState(int slot, const Common::String &desc);
 	bool canLoadGameStateCurrently();
@@ -34,6 +34,10 @@
 #include "scumm/he/wiz_he.h"
 #include "scumm/util.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #ifdef USE_ARM_GFX_ASM
 
 #ifndef IPHONE
@@ -694,7 +698,22 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 			const uint32 *text32 = (const uint32 *)text;
 			const int textPitch = (_textSurface.pitch - width * m) >> 2;
 			for (int h = height * m; h > 0; --h) {
-				for (int w = width * m; w > 0; w -= 4) {
+				int w = width * m;
+#ifdef __SSE2__
+				// Compose 16 pixels at a time, picking the game graphics
+				// wherever the text is transparent
+				const __m128i transparency = _mm_set1_epi8((char)CHARSET_MASK_TRANSPARENCY);
+				for (; w >= 16; w -= 16) {
+					const __m128i textPixels = _mm_loadu_si128((const __m128i *)text32);
+					const __m128i srcPixels = _mm_loadu_si128((const __m128i *)src32);
+					const __m128i mask = _mm_cmpeq_epi8(textPixels, transparency);
+					_mm_storeu_si128((__m128i *)dst32, _mm_or_si128(_mm_and_si128(mask, srcPixels), _mm_andnot_si128(mask, textPixels)));
+					text32 += 4;
+					src32 += 4;
+					dst32 += 4;
+				}
+#endif
+				for (; w > 0; w -= 4) {
 					uint32 temp = *text32++;
 
 					// Generate a byte mask for those text pixels (bytes) with
@@ -51,6 +51,10 @@ public:
 		return (_pImage != 0);
 	}
 
+	virtual uint getMemoryUsage() const {
+		return _pImage ? _pImage->getMemoryUsage() : 0;
+	}
+
 	/**
 	    @brief Gibt die Breite des Bitmaps zurck.
 	*/
@@ -42,6 +42,7 @@
 #include "sword25/gfx/image/swimage.h"
 #include "sword25/gfx/image/vectorimage.h"
 #include "sword25/package/packagemanager.h"
+#include "sword25/kernel/resmanager.h"
 #include "sword25/kernel/inputpersistenceblock.h"
 #include "sword25/kernel/outputpersistenceblock.h"
 
@@ -61,6 +62,8 @@ enum {
 namespace Sword25 {
 
 static const uint FRAMETIME_SAMPLE_COUNT = 5;       // Frame duration is averaged over FRAMETIME_SAMPLE_COUNT frames
+static const uint PRECACHE_TIME_PER_FRAME = 8;      // Milliseconds per frame spent loading queued resources
+static const uint VECTOR_RENDERING_CACHE_SIZE = 8 * 1024 * 1024; // Byte budget for the rasterized copies of all vector images
 
 GraphicEngine::GraphicEngine(Kernel *pKernel) :
 	_width(0),
@@ -71,6 +74,7 @@ GraphicEngine::GraphicEngine(Kernel *pKernel) :
 	_timerActive(true),
 	_frameTimeSampleSlot(0),
 	_thumbnail(NULL),
+	_vectorRenderingsSize(0),
 	ResourceService(pKernel) {
 	_frameTimeSamples.resize(FRAMETIME_SAMPLE_COUNT);
 
@@ -84,6 +88,53 @@ GraphicEngine::~GraphicEngine() {
 	unregisterScriptBindings();
 	_backSurface.free();
 	delete _thumbnail;
+
+	for (Common::List<CachedRendering>::iterator it = _vectorRenderings.begin(); it != _vectorRenderings.end(); ++it)
+		free(it->_pixelData);
+}
+
+byte *GraphicEngine::getVectorRendering(VectorImage *image, int width, int height) {
+	Common::List<CachedRendering>::iterator it;
+	for (it = _vectorRenderings.begin(); it != _vectorRenderings.end(); ++it) {
+		if (it->_image == image && it->_width == width && it->_height == height) {
+			if (it != _vectorRenderings.begin()) {
+				_vectorRenderings.push_front(*it);
+				_vectorRenderings.erase(it);
+			}
+			return _vectorRenderings.front()._pixelData;
+		}
+	}
+
+	CachedRendering rendering;
+	rendering._image = image;
+	rendering._width = width;
+	rendering._height = height;
+	rendering._pixelData = image->render(width, height);
+	_vectorRenderings.push_front(rendering);
+	_vectorRenderingsSize += width * height * 4;
+
+	// Evict the least recently used renderings, but always keep the new one
+	while (_vectorRenderingsSize > VECTOR_RENDERING_CACHE_SIZE && _vectorRenderings.size() > 1) {
+		CachedRendering &last = _vectorRenderings.back();
+		_vectorRenderingsSize -= last._width * last._height * 4;
+		free(last._pixelData);
+		_vectorRenderings.pop_back();
+	}
+
+	return rendering._pixelData;
+}
+
+void GraphicEngine::freeVectorRenderings(const VectorImage *image) {
+	Common::List<CachedRendering>::iterator it = _vectorRenderings.begin();
+	while (it != _vectorRenderings.end()) {
+		if (it->_image == image) {
+			_vectorRenderingsSize -= it->_width * it->_height * 4;
+			free(it->_pixelData);
+			it = _vectorRenderings.erase(it);
+		} else {
+			++it;
+		}
+	}
 }
 
 bool GraphicEngine::init(int width, int height, int bitDepth, int backbufferCount) {
@@ -146,6 +197,10 @@ bool GraphicEngine::endFrame() {
 
 	g_system->updateScreen();
 
+	// Use some of the time till the next frame to load resources the game
+	// announced it will need
+	Kernel::getInstance()->getResourceManager()->processPrecacheQueue(PRECACHE_TIME_PER_FRAME);
+
 	return true;
 }
 
@@ -42,6 +42,7 @@
 
 // Includes
 #include "common/array.h"
+#include "common/list.h"
 #include "common/rect.h"
 #include "common/ptr.h"
 #include "common/str.h"
@@ -56,6 +57,7 @@ namespace Sword25 {
 
 class Kernel;
 class Image;
+class VectorImage;
 class Panel;
 class Screenshot;
 class RenderObjectManager;
@@ -270,6 +272,22 @@ public:
 		return -1;
 	}
 
+	/**
+	 * Returns a rasterized copy of a vector image, rendering it unless it was
+	 * recently drawn at the same size. The copies of all vector images share
+	 * one byte budget and are evicted least recently used first.
+	 * @param image     The vector image
+	 * @param width     The width to render the image at
+	 * @param height    The height to render the image at
+	 * @return          The ARGB pixels, owned by the cache
+	 */
+	byte *getVectorRendering(VectorImage *image, int width, int height);
+
+	/**
+	 * Drops the rasterized copies of a vector image which is going away
+	 */
+	void freeVectorRenderings(const VectorImage *image);
+
 	// Resource-Managing Methods
 	// --------------------------
 	virtual Resource *loadResource(const Common::String &fileName);
@@ -312,6 +330,15 @@ private:
 private:
 	RenderObjectPtr<Panel> _mainPanelPtr;
 
+	struct CachedRendering {
+		const VectorImage *_image;
+		int _width;
+		int _height;
+		byte *_pixelData;
+	};
+	Common::List<CachedRendering> _vectorRenderings; ///< Most recently used first
+	uint _vectorRenderingsSize; ///< Size of the cached renderings in bytes
+
 	Common::ScopedPtr<RenderObjectManager> _renderObjectManagerPtr;
 
 	struct DebugLine {
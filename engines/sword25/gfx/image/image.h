@@ -71,6 +71,13 @@ public:
 	*/
 	virtual GraphicEngine::COLOR_FORMATS getColorFormat() const = 0;
 
+	/**
+	    @brief Returns the number of bytes of decoded pixel data the image keeps in memory
+	*/
+	virtual uint getMemoryUsage() const {
+		return getWidth() * getHeight() * 4;
+	}
+
 	//@}
 
 	//@{
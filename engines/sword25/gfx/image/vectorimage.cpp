@@ -36,6 +36,8 @@
 #include "sword25/gfx/image/art.h"
 #include "sword25/gfx/image/vectorimage.h"
 #include "sword25/gfx/image/renderedimage.h"
+#include "sword25/gfx/graphicengine.h"
+#include "sword25/kernel/kernel.h"
 
 #include "graphics/colormasks.h"
 
@@ -215,7 +217,7 @@ Common::Rect CalculateBoundingBox(const VectorImageElement &vectorImageElement)
 // Construction
 // -----------------------------------------------------------------------------
 
-VectorImage::VectorImage(const byte *pFileData, uint fileSize, bool &success, const Common::String &fname) : _pixelData(0), _fname(fname) {
+VectorImage::VectorImage(const byte *pFileData, uint fileSize, bool &success, const Common::String &fname) : _fname(fname) {
 	success = false;
 	_bgColor = 0;
 
@@ -312,7 +314,11 @@ VectorImage::~VectorImage() {
 			if (_elements[j].getPathInfo(i).getVec())
 				free(_elements[j].getPathInfo(i).getVec());
 
-	free(_pixelData);
+	// The graphics engine is already gone when the kernel shuts down, and
+	// took the renderings with it
+	GraphicEngine *gfx = Kernel::getInstance()->getGfx();
+	if (gfx)
+		gfx->freeVectorRenderings(this);
 }
 
 
@@ -616,26 +622,16 @@ bool VectorImage::blit(int posX, int posY,
                        uint color,
                        int width, int height,
 					   RectangleList *updateRects) {
-	static VectorImage *oldThis = 0;
-	static int              oldWidth = -2;
-	static int              oldHeight = -2;
-
 	// If width or height to 0, nothing needs to be shown.
 	if (width == 0 || height == 0)
 		return true;
 
-	// Determine if the old image in the cache can not be reused and must be recalculated
-	if (!(oldThis == this && oldWidth == width && oldHeight == height)) {
-		render(width, height);
-
-		oldThis = this;
-		oldHeight = height;
-		oldWidth = width;
-	}
+	// Color modulation is applied by the blit, so one rendering serves all colors
+	byte *pixelData = Kernel::getInstance()->getGfx()->getVectorRendering(this, width, height);
 
 	RenderedImage *rend = new RenderedImage();
 
-	rend->replaceContent(_pixelData, width, height);
+	rend->replaceContent(pixelData, width, height);
 	rend->blit(posX, posY, flipping, pPartRect, color, width, height, updateRects);
 
 	delete rend;
@@ -181,9 +181,17 @@ public:
 	virtual GraphicEngine::COLOR_FORMATS getColorFormat() const {
 		return GraphicEngine::CF_ARGB32;
 	}
+	virtual uint getMemoryUsage() const {
+		// Rasterizations have a budget of their own
+		return 0;
+	}
 	virtual bool fill(const Common::Rect *pFillRect = 0, uint color = BS_RGB(0, 0, 0));
 
-	void render(int width, int height);
+	/**
+	 * Rasterizes the image at the given size.
+	 * @return a newly malloc()ed ARGB buffer of width * height pixels
+	 */
+	byte *render(int width, int height);
 
 	virtual uint getPixel(int x, int y);
 	virtual bool isBlitSource() const {
@@ -225,8 +233,6 @@ private:
 	Common::Array<VectorImageElement>    _elements;
 	Common::Rect                         _boundingBox;
 
-	byte *_pixelData;
-
 	Common::String _fname;
 	uint _bgColor;
 };
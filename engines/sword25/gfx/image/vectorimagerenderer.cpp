@@ -42,6 +42,10 @@
 #include "sword25/gfx/image/vectorimage.h"
 #include "graphics/colormasks.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace Sword25 {
 
 void art_rgb_fill_run1(byte *buf, byte r, byte g, byte b, int n) {
@@ -59,10 +63,34 @@ void art_rgb_fill_run1(byte *buf, byte r, byte g, byte b, int n) {
 }
 
 void art_rgb_run_alpha1(byte *buf, byte r, byte g, byte b, int alpha, int n) {
-	int i;
+	int i = 0;
 	int v;
 
-	for (i = 0; i < n; i++) {
+#if defined(__SSE2__) && defined(SCUMM_LITTLE_ENDIAN)
+	// Four pixels at a time. v + (((c - v) * alpha + 0x80) >> 8) is computed
+	// as (c * alpha + v * (256 - alpha) + 0x80) >> 8, which is the same value
+	// but fits unsigned 16-bit lanes. The alpha byte is blended with weight
+	// 256 (i.e. left as is) and then saturating-added to.
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i add = _mm_set_epi16(r * alpha + 0x80, g * alpha + 0x80, b * alpha + 0x80, 0x80,
+	                                  r * alpha + 0x80, g * alpha + 0x80, b * alpha + 0x80, 0x80);
+	const __m128i weight = _mm_set_epi16(256 - alpha, 256 - alpha, 256 - alpha, 256,
+	                                     256 - alpha, 256 - alpha, 256 - alpha, 256);
+	const __m128i alphaAdd = _mm_set1_epi32(MIN(alpha, 0xff));
+
+	for (; i + 4 <= n; i += 4) {
+		__m128i src = _mm_loadu_si128((const __m128i *)buf);
+		__m128i lo = _mm_unpacklo_epi8(src, zero);
+		__m128i hi = _mm_unpackhi_epi8(src, zero);
+		lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(lo, weight), add), 8);
+		hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(hi, weight), add), 8);
+		__m128i dst = _mm_adds_epu8(_mm_packus_epi16(lo, hi), alphaAdd);
+		_mm_storeu_si128((__m128i *)buf, dst);
+		buf += 16;
+	}
+#endif
+
+	for (; i < n; i++) {
 #if defined(SCUMM_LITTLE_ENDIAN)
 		v = *buf;
 		*buf++ = MIN(v + alpha, 0xff);
@@ -400,17 +428,14 @@ void drawBez(ArtBpath *bez1, ArtBpath *bez2, byte *buffer, int width, int height
 	free(vec);
 }
 
-void VectorImage::render(int width, int height) {
+byte *VectorImage::render(int width, int height) {
 	double scaleX = (width == - 1) ? 1 : static_cast<double>(width) / static_cast<double>(getWidth());
 	double scaleY = (height == - 1) ? 1 : static_cast<double>(height) / static_cast<double>(getHeight());
 
 	debug(3, "VectorImage::render(%d, %d) %s", width, height, _fname.c_str());
 
-	if (_pixelData)
-		free(_pixelData);
-
-	_pixelData = (byte *)malloc(width * height * 4);
-	memset(_pixelData, 0, width * height * 4);
+	byte *pixelData = (byte *)malloc(width * height * 4);
+	memset(pixelData, 0, width * height * 4);
 
 	for (uint e = 0; e < _elements.size(); e++) {
 
@@ -451,7 +476,7 @@ void VectorImage::render(int width, int height) {
 			(*fill0pos).code = ART_END;
 			(*fill1pos).code = ART_END;
 
-			drawBez(fill1, fill0, _pixelData, width, height, _boundingBox.left, _boundingBox.top, scaleX, scaleY, -1, _elements[e].getFillStyleColor(s));
+			drawBez(fill1, fill0, pixelData, width, height, _boundingBox.left, _boundingBox.top, scaleX, scaleY, -1, _elements[e].getFillStyleColor(s));
 
 			free(fill0);
 			free(fill1);
@@ -464,11 +489,13 @@ void VectorImage::render(int width, int height) {
 
 			for (uint p = 0; p < _elements[e].getPathCount(); p++) {
 				if (_elements[e].getPathInfo(p).getLineStyle() == s + 1) {
-					drawBez(_elements[e].getPathInfo(p).getVec(), 0, _pixelData, width, height, _boundingBox.left, _boundingBox.top, scaleX, scaleY, penWidth, _elements[e].getLineStyleColor(s));
+					drawBez(_elements[e].getPathInfo(p).getVec(), 0, pixelData, width, height, _boundingBox.left, _boundingBox.top, scaleX, scaleY, penWidth, _elements[e].getLineStyleColor(s));
 				}
 			}
 		}
 	}
+
+	return pixelData;
 }
 
 
@@ -313,6 +313,9 @@ static int precacheResource(lua_State *L) {
 #ifdef PRECACHE_RESOURCES
 	lua_pushbooleancpp(L, pResource->precacheResource(luaL_checkstring(L, 1)));
 #else
+	// Load the resource in the spare time of the next frames instead of
+	// stalling the script
+	pResource->queuePrecache(luaL_checkstring(L, 1));
 	lua_pushbooleancpp(L, true);
 #endif
 
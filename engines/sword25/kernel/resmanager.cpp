@@ -35,6 +35,8 @@
 #include "sword25/kernel/resservice.h"
 #include "sword25/package/packagemanager.h"
 
+#include "common/system.h"
+
 namespace Sword25 {
 
 // Sets the amount of resources that are simultaneously loaded.
@@ -46,6 +48,10 @@ namespace Sword25 {
 // are loaded, the resource manager will start purging resources till it
 // hits the minimum limit above
 #define SWORD25_RESOURCECACHE_MAX 500
+// The memory the decoded resources may use, in bytes. Like the count limits,
+// exceeding the maximum purges resources till the usage is below the minimum.
+#define SWORD25_RESOURCECACHE_MEMORY_MIN (96 * 1024 * 1024)
+#define SWORD25_RESOURCECACHE_MEMORY_MAX (128 * 1024 * 1024)
 
 ResourceManager::~ResourceManager() {
 	// Clear all unlocked resources
@@ -87,7 +93,7 @@ bool ResourceManager::registerResourceService(ResourceService *pService) {
  */
 void ResourceManager::deleteResourcesIfNecessary() {
 	// If enough memory is available, or no resources are loaded, then the function can immediately end
-	if (_resources.size() < SWORD25_RESOURCECACHE_MAX)
+	if (_resources.size() < SWORD25_RESOURCECACHE_MAX && _usedMemory < SWORD25_RESOURCECACHE_MEMORY_MAX)
 		return;
 
 	// Keep deleting resources until the memory usage of the process falls below the set maximum limit.
@@ -100,7 +106,8 @@ void ResourceManager::deleteResourcesIfNecessary() {
 		// The resource may be released only if it isn't locked
 		if ((*iter)->getLockCount() == 0)
 			iter = deleteResource(*iter);
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+	} while (iter != _resources.begin() &&
+	         (_resources.size() >= SWORD25_RESOURCECACHE_MIN || _usedMemory >= SWORD25_RESOURCECACHE_MEMORY_MIN));
 
 	// Are we still above the minimum? If yes, then start releasing locked resources
 	// FIXME: This code shouldn't be needed at all, but it seems like there is a bug
@@ -220,6 +227,26 @@ bool ResourceManager::precacheResource(const Common::String &fileName, bool forc
 
 #endif
 
+void ResourceManager::queuePrecache(const Common::String &fileName) {
+	Common::String uniqueFileName = getUniqueFileName(fileName);
+	if (!uniqueFileName.empty() && !getResource(uniqueFileName))
+		_precacheQueue.push(uniqueFileName);
+}
+
+void ResourceManager::processPrecacheQueue(uint32 maxMillis) {
+	uint32 startTime = g_system->getMillis();
+	while (!_precacheQueue.empty() && g_system->getMillis() - startTime < maxMillis) {
+		Common::String uniqueFileName = _precacheQueue.pop();
+
+		// The game may have requested the resource in the meantime
+		if (getResource(uniqueFileName))
+			continue;
+
+		if (!loadResource(uniqueFileName))
+			debugC(kDebugResource, "Could not precache \"%s\".", uniqueFileName.c_str());
+	}
+}
+
 /**
  * Moves a resource to the top of the resource list
  * @param pResource     The resource
@@ -256,6 +283,8 @@ Resource *ResourceManager::loadResource(const Common::String &fileName) {
 			// Add the resource to the front of the list
 			_resources.push_front(pResource);
 			pResource->_iterator = _resources.begin();
+			pResource->_memoryUsage = pResource->getMemoryUsage();
+			_usedMemory += pResource->_memoryUsage;
 
 			// Also store the resource in the hash table for quick lookup
 			_resourceHashMap[pResource->getFileName()] = pResource;
@@ -298,6 +327,7 @@ Common::List<Resource *>::iterator ResourceManager::deleteResource(Resource *pRe
 
 	// Delete the resource from the resource list
 	Common::List<Resource *>::iterator result = _resources.erase(pResource->_iterator);
+	_usedMemory -= pResource->_memoryUsage;
 
 	// Delete the resource
 	delete pResource;
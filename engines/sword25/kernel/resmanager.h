@@ -35,6 +35,7 @@
 #include "common/list.h"
 #include "common/hashmap.h"
 #include "common/hash-str.h"
+#include "common/queue.h"
 
 #include "sword25/kernel/common.h"
 
@@ -66,6 +67,19 @@ public:
 	bool precacheResource(const Common::String &fileName, bool forceReload = false);
 #endif
 
+	/**
+	 * Queues a resource to be loaded in the spare time of the next frames, so
+	 * that it's already in the cache when the game requests it.
+	 * @param FileName      The filename of the resource to be cached
+	 */
+	void queuePrecache(const Common::String &fileName);
+
+	/**
+	 * Loads queued resources until the given time has passed or the queue is empty.
+	 * @param MaxMillis     The time that may be spent loading
+	 */
+	void processPrecacheQueue(uint32 maxMillis);
+
 	/**
 	 * Registers a RegisterResourceService. This method is the constructor of
 	 * BS_ResourceService, and thus helps all resource services in the ResourceManager list
@@ -94,7 +108,8 @@ private:
 	 * Only the BS_Kernel class can generate copies this class. Thus, the constructor is private
 	 */
 	ResourceManager(Kernel *pKernel) :
-		_kernelPtr(pKernel)
+		_kernelPtr(pKernel),
+		_usedMemory(0)
 	{}
 	virtual ~ResourceManager();
 
@@ -139,6 +154,8 @@ private:
 	Common::List<Resource *> _resources;
 	typedef Common::HashMap<Common::String, Resource *> ResMap;
 	ResMap _resourceHashMap;
+	uint32 _usedMemory;                         ///< The memory usage of all loaded resources in bytes
+	Common::Queue<Common::String> _precacheQueue; ///< Unique filenames of the resources to precache
 };
 
 } // End of namespace Sword25
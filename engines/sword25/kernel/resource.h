@@ -92,6 +92,14 @@ public:
 		return _type;
 	}
 
+	/**
+	 * Returns the number of bytes the resource keeps in memory, as far as it
+	 * is significant for the resource cache budget
+	 */
+	virtual uint getMemoryUsage() const {
+		return 0;
+	}
+
 protected:
 	virtual ~Resource() {}
 
@@ -99,6 +107,7 @@ private:
 	Common::String _fileName;          ///< The absolute filename
 	uint _refCount;          ///< The number of locks
 	uint _type;              ///< The type of the resource
+	uint _memoryUsage;       ///< The memory usage accounted for by the resource manager
 	Common::List<Resource *>::iterator _iterator;        ///< Points to the resource position in the LRU list
 };
 
@@ -40,6 +40,11 @@
 #include "common/config-manager.h"
 
 #define DIRTY_RECT_LIMIT 800
+// Above this many disjoint dirty rects, redrawing their union is cheaper
+#define DIRTY_RECT_MAX_COUNT 16
+// Byte budget and entry limit of the scaled/rotated surface cache
+#define TRANSFORM_CACHE_SIZE (8 * 1024 * 1024)
+#define TRANSFORM_CACHE_MAX_COUNT 64
 
 namespace Wintermute {
 
@@ -57,7 +62,7 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
+	_transformCacheSize = 0;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
@@ -75,7 +80,8 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		delete ticket;
 	}
 
-	delete _dirtyRect;
+	_dirtyRects.clear();
+	_transformCache.clear();
 
 	_renderSurface->free();
 	delete _renderSurface;
@@ -154,8 +160,7 @@ bool BaseRenderOSystem::indicatorFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -194,9 +199,7 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects || screenChanged) {
 			g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		//  g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -326,6 +329,68 @@ void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
 			invalidateTicket(*it);
 		}
 	}
+	invalidateCachedTransforms(surf);
+}
+
+bool BaseRenderOSystem::CachedTransform::matches(const BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, bool bilinear) const {
+	// TransformStruct::operator== doesn't compare the hotspot, which rotation depends on
+	return _owner == owner && _srcRect == srcRect &&
+		_width == dstRect.width() && _height == dstRect.height() &&
+		_transform == transform && _transform._hotspot == transform._hotspot &&
+		_bilinear == bilinear;
+}
+
+Common::SharedPtr<Graphics::Surface> BaseRenderOSystem::getCachedTransform(const BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform) {
+	bool bilinear = _gameRef->getBilinearFiltering();
+	for (TransformCache::iterator it = _transformCache.begin(); it != _transformCache.end(); ++it) {
+		if (it->matches(owner, srcRect, dstRect, transform, bilinear)) {
+			// Move to the front, so the least recently used entries end up at the back
+			if (it != _transformCache.begin()) {
+				_transformCache.push_front(*it);
+				_transformCache.erase(it);
+			}
+			return _transformCache.front()._surface;
+		}
+	}
+	return Common::SharedPtr<Graphics::Surface>();
+}
+
+void BaseRenderOSystem::addCachedTransform(const BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, const Common::SharedPtr<Graphics::Surface> &surface) {
+	uint32 size = surface->pitch * surface->h;
+	if (size > TRANSFORM_CACHE_SIZE / 4) {
+		return;
+	}
+
+	CachedTransform entry;
+	entry._owner = owner;
+	entry._srcRect = srcRect;
+	entry._width = dstRect.width();
+	entry._height = dstRect.height();
+	entry._transform = transform;
+	entry._bilinear = _gameRef->getBilinearFiltering();
+	entry._surface = surface;
+	_transformCache.push_front(entry);
+	_transformCacheSize += size;
+
+	// Tickets still using an evicted surface keep it alive through their own reference
+	while (_transformCacheSize > TRANSFORM_CACHE_SIZE || _transformCache.size() > TRANSFORM_CACHE_MAX_COUNT) {
+		const Graphics::Surface *last = _transformCache.back()._surface.get();
+		_transformCacheSize -= last->pitch * last->h;
+		_transformCache.pop_back();
+	}
+}
+
+void BaseRenderOSystem::invalidateCachedTransforms(const BaseSurfaceOSystem *owner) {
+	TransformCache::iterator it = _transformCache.begin();
+	while (it != _transformCache.end()) {
+		if (it->_owner == owner) {
+			const Graphics::Surface *surf = it->_surface.get();
+			_transformCacheSize -= surf->pitch * surf->h;
+			it = _transformCache.erase(it);
+		} else {
+			++it;
+		}
+	}
 }
 
 void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
@@ -365,12 +430,37 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect dirty(rect);
+	dirty.clip(_renderRect);
+	if (dirty.isEmpty()) {
+		return;
+	}
+
+	// Merge with every rect that overlaps or touches the new one, until the
+	// new rect is disjoint from the rest of the list.
+	bool merged;
+	do {
+		merged = false;
+		Common::Rect grown(dirty.left - 1, dirty.top - 1, dirty.right + 1, dirty.bottom + 1);
+		for (uint i = 0; i < _dirtyRects.size(); ++i) {
+			if (grown.intersects(_dirtyRects[i])) {
+				dirty.extend(_dirtyRects[i]);
+				_dirtyRects.remove_at(i);
+				merged = true;
+				break;
+			}
+		}
+	} while (merged);
+	_dirtyRects.push_back(dirty);
+
+	if (_dirtyRects.size() > DIRTY_RECT_MAX_COUNT) {
+		Common::Rect all(_dirtyRects[0]);
+		for (uint i = 1; i < _dirtyRects.size(); ++i) {
+			all.extend(_dirtyRects[i]);
+		}
+		_dirtyRects.clear();
+		_dirtyRects.push_back(all);
 	}
-	_dirtyRect->clip(_renderRect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -389,7 +479,7 @@ void BaseRenderOSystem::drawTickets() {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+	if (_dirtyRects.empty()) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
@@ -399,43 +489,42 @@ void BaseRenderOSystem::drawTickets() {
 		return;
 	}
 
-	it = _renderQueue.begin();
 	_lastFrameIter = _renderQueue.end();
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
+	bool singleOpaque = !_renderQueue.empty() && _renderQueue.front() == _renderQueue.back() && _renderQueue.front()->_transform._alphaDisable == true;
+	for (uint i = 0; i < _dirtyRects.size(); ++i) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
 		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+		if (!singleOpaque || dirtyRect != _renderQueue.front()->_dstRect) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRect, _clearColor);
 		}
-		// Otherwise Do NOT fill.
-	} else {
-		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
-	}
-	for (; it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+			RenderTicket *ticket = *it;
+			if (ticket->_dstRect.intersects(dirtyRect)) {
+				// dstClip is the area we want redrawn.
+				Common::Rect dstClip(ticket->_dstRect);
+				// reduce it to the dirty rect
+				dstClip.clip(dirtyRect);
+				// we need to keep track of the position to redraw the dirty rect
+				Common::Rect pos(dstClip);
+				int16 offsetX = ticket->_dstRect.left;
+				int16 offsetY = ticket->_dstRect.top;
+				// convert from screen-coords to surface-coords.
+				dstClip.translate(-offsetX, -offsetY);
+
+				drawFromSurface(ticket, &pos, &dstClip);
+				_needsFlip = true;
+			}
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
-		ticket->_wantsDraw = false;
+		g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+	}
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
@@ -32,7 +32,9 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
+#include "common/array.h"
 #include "common/list.h"
+#include "common/ptr.h"
 #include "graphics/transform_struct.h"
 
 namespace Wintermute {
@@ -53,6 +55,9 @@ class RenderTicket;
  * being equal, this information is then used to check whether the draw order changed,
  * which will then create a need for redrawing, as we draw with an alpha-channel here.
  *
+ * The dirty areas are kept as a short list of disjoint rects, so that changes in
+ * opposite corners of the screen don't cause everything in between to be redrawn.
+ *
  * There is also a draw path that draws without tickets, for debugging purposes,
  * as well as to accomodate situations with large enough amounts of draw calls,
  * that there will be too much overhead involved with comparing the generated tickets.
@@ -112,7 +117,41 @@ public:
 	void endSaveLoad();
 	void drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
 	BaseSurface *createSurface() override;
+
+	/**
+	 * Look up a scaled or rotated copy of part of a surface, as made by an
+	 * earlier RenderTicket.
+	 * @param owner the surface that was transformed
+	 * @param srcRect the part of the surface that was transformed
+	 * @param dstRect the area the copy is drawn to
+	 * @param transform the transform that was applied
+	 * @return the transformed copy, or an empty pointer if it's not cached
+	 */
+	Common::SharedPtr<Graphics::Surface> getCachedTransform(const BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform);
+	/**
+	 * Store a scaled or rotated copy of part of a surface, evicting the least
+	 * recently used copies if the cache grows too large.
+	 */
+	void addCachedTransform(const BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, const Common::SharedPtr<Graphics::Surface> &surface);
 private:
+	struct CachedTransform {
+		const BaseSurfaceOSystem *_owner;
+		Common::Rect _srcRect;
+		int16 _width;
+		int16 _height;
+		Graphics::TransformStruct _transform;
+		bool _bilinear;
+		Common::SharedPtr<Graphics::Surface> _surface;
+
+		bool matches(const BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect, const Graphics::TransformStruct &transform, bool bilinear) const;
+	};
+	typedef Common::List<CachedTransform> TransformCache;
+
+	/**
+	 * Drop all cached transforms of a surface, e.g. because its pixels change.
+	 */
+	void invalidateCachedTransforms(const BaseSurfaceOSystem *owner);
+
 	/**
 	 * Mark a specified rect of the screen as dirty.
 	 * @param rect the region to be marked as dirty
@@ -126,8 +165,10 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+	Common::Array<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
+	TransformCache _transformCache; ///< Most recently used transforms first
+	uint32 _transformCacheSize; ///< Size of the cached transforms in bytes
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
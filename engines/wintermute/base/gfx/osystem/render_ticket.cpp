@@ -29,6 +29,7 @@
 
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/gfx/osystem/render_ticket.h"
+#include "engines/wintermute/base/gfx/osystem/base_render_osystem.h"
 #include "engines/wintermute/base/gfx/osystem/base_surface_osystem.h"
 #include "graphics/transform_tools.h"
 #include "common/textconsole.h"
@@ -43,55 +44,63 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	_wantsDraw(true),
 	_transform(transform) {
 	if (surf) {
-		_surface = new Graphics::Surface();
-		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
-		assert(_surface->format.bytesPerPixel == 4);
+		// NB: The numTimesX/numTimesY properties don't yet mix well with
+		// scaling and rotation, but there is no need for that functionality at
+		// the moment.
+		const bool rotate = _transform._angle != Graphics::kDefaultAngle;
+		const bool scale = (dstRect->width() != srcRect->width() ||
+							dstRect->height() != srcRect->height()) &&
+							_transform._numTimesX * _transform._numTimesY == 1;
+
+		// A transformed copy only depends on the source, so the same sprite
+		// drawn the same way in an earlier frame can provide it. The copies
+		// of a surface are dropped along with its tickets, which happens in
+		// startPixelOp(), putSurface() and the surface destructor.
+		BaseRenderOSystem *renderer = nullptr;
+		if (owner && (rotate || scale)) {
+			renderer = static_cast<BaseRenderOSystem *>(owner->_gameRef->_renderer);
+			_surface = renderer->getCachedTransform(owner, *srcRect, *dstRect, transform);
+			if (_surface)
+				return;
+		}
+
+		Graphics::Surface *temp = new Graphics::Surface();
+		temp->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
+		assert(temp->format.bytesPerPixel == 4);
 		// Get a clipped copy of the surface
-		for (int i = 0; i < _surface->h; i++) {
-			memcpy(_surface->getBasePtr(0, i), surf->getBasePtr(srcRect->left, srcRect->top + i), srcRect->width() * _surface->format.bytesPerPixel);
+		for (int i = 0; i < temp->h; i++) {
+			memcpy(temp->getBasePtr(0, i), surf->getBasePtr(srcRect->left, srcRect->top + i), srcRect->width() * temp->format.bytesPerPixel);
 		}
 		// Then scale it if necessary
 		//
-		// NB: The numTimesX/numTimesY properties don't yet mix well with
-		// scaling and rotation, but there is no need for that functionality at
-		// the moment.
 		// NB: Mirroring and rotation are probably done in the wrong order.
 		// (Mirroring should most likely be done before rotation. See also
 		// TransformTools.)
-		if (_transform._angle != Graphics::kDefaultAngle) {
-			Graphics::TransparentSurface src(*_surface, false);
-			Graphics::Surface *temp;
-			if (owner->_gameRef->getBilinearFiltering()) {
-				temp = src.rotoscaleT<Graphics::FILTER_BILINEAR>(transform);
-			} else {
-				temp = src.rotoscaleT<Graphics::FILTER_NEAREST>(transform);
-			}
-			_surface->free();
-			delete _surface;
-			_surface = temp;
-		} else if ((dstRect->width() != srcRect->width() ||
-					dstRect->height() != srcRect->height()) &&
-					_transform._numTimesX * _transform._numTimesY == 1) {
-			Graphics::TransparentSurface src(*_surface, false);
-			Graphics::Surface *temp;
-			if (owner->_gameRef->getBilinearFiltering()) {
-				temp = src.scaleT<Graphics::FILTER_BILINEAR>(dstRect->width(), dstRect->height());
+		if (rotate || scale) {
+			Graphics::TransparentSurface src(*temp, false);
+			Graphics::Surface *transformed;
+			if (rotate) {
+				if (owner->_gameRef->getBilinearFiltering()) {
+					transformed = src.rotoscaleT<Graphics::FILTER_BILINEAR>(transform);
+				} else {
+					transformed = src.rotoscaleT<Graphics::FILTER_NEAREST>(transform);
+				}
 			} else {
-				temp = src.scaleT<Graphics::FILTER_NEAREST>(dstRect->width(), dstRect->height());
+				if (owner->_gameRef->getBilinearFiltering()) {
+					transformed = src.scaleT<Graphics::FILTER_BILINEAR>(dstRect->width(), dstRect->height());
+				} else {
+					transformed = src.scaleT<Graphics::FILTER_NEAREST>(dstRect->width(), dstRect->height());
+				}
 			}
-			_surface->free();
-			delete _surface;
-			_surface = temp;
+			temp->free();
+			delete temp;
+			temp = transformed;
 		}
-	} else {
-		_surface = nullptr;
-	}
-}
+		_surface = Common::SharedPtr<Graphics::Surface>(temp, Graphics::SurfaceDeleter());
 
-RenderTicket::~RenderTicket() {
-	if (_surface) {
-		_surface->free();
-		delete _surface;
+		if (renderer) {
+			renderer->addCachedTransform(owner, *srcRect, *dstRect, transform, _surface);
+		}
 	}
 }
 
@@ -35,7 +35,9 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 	  _renderState(FLAT) {
 	assert(numRows != 0 && numColumns != 0);
 
-	_internalBuffer = new Common::Point[numRows * numColumns];
+	_internalBuffer = new uint32[numRows * numColumns];
+	for (uint32 i = 0; i < numRows * numColumns; ++i)
+		_internalBuffer[i] = i;
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
@@ -75,54 +77,42 @@ const Common::Point RenderTable::convertWarpedCoordToFlatCoord(const Common::Poi
 	}
 
 	uint32 index = point.y * _numColumns + point.x;
+	uint32 sourceIndex = _internalBuffer[index];
 
-	Common::Point newPoint(point);
-	newPoint.x += _internalBuffer[index].x;
-	newPoint.y += _internalBuffer[index].y;
-
-	return newPoint;
+	return Common::Point(sourceIndex % _numColumns, sourceIndex / _numColumns);
 }
 
 void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
-	uint32 destOffset = 0;
+	int16 width = subRect.width();
 
 	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
-		uint32 sourceOffset = y * _numColumns;
-
-		for (int16 x = subRect.left; x < subRect.right; ++x) {
-			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
-
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+		const uint32 *sourceIndex = _internalBuffer + y * _numColumns + subRect.left;
 
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-		}
+		for (int16 x = 0; x < width; ++x)
+			destBuffer[x] = sourceBuffer[sourceIndex[x]];
 
-		destOffset += destWidth;
+		destBuffer += destWidth;
 	}
 }
 
 void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
-
-	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
+	const uint16 *sourceBuffer = (const uint16 *)srcBuf->getPixels();
 	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
 
 	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
-
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
-
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
+		const uint32 *sourceIndex = _internalBuffer + y * _numColumns;
+
+		// Unrolled, as this runs for every pixel of every frame while panning
+		int16 x = 0;
+		for (; x + 4 <= srcBuf->w; x += 4) {
+			destBuffer[0] = sourceBuffer[sourceIndex[x]];
+			destBuffer[1] = sourceBuffer[sourceIndex[x + 1]];
+			destBuffer[2] = sourceBuffer[sourceIndex[x + 2]];
+			destBuffer[3] = sourceBuffer[sourceIndex[x + 3]];
+			destBuffer += 4;
 		}
+		for (; x < srcBuf->w; ++x)
+			*destBuffer++ = sourceBuffer[sourceIndex[x]];
 	}
 }
 
@@ -141,13 +131,8 @@ void RenderTable::generateRenderTable() {
 }
 
 void RenderTable::generatePanoramaLookupTable() {
-	for (uint y = 0; y < _numRows; y++) {
-		for (uint x = 0; x < _numColumns; x++) {
-			uint32 index = y * _numColumns + x;
-			_internalBuffer[index].x = 0;
-			_internalBuffer[index].y = 0;
-		}
-	}
+	for (uint32 i = 0; i < _numRows * _numColumns; ++i)
+		_internalBuffer[i] = i;
 
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
@@ -173,9 +158,8 @@ void RenderTable::generatePanoramaLookupTable() {
 
 			uint32 index = y * _numColumns + x;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			// Store the index of the source pixel, so warping needs no arithmetic
+			_internalBuffer[index] = yInCylinderCoords * _numColumns + xInCylinderCoords;
 		}
 	}
 }
@@ -208,9 +192,8 @@ void RenderTable::generateTiltLookupTable() {
 
 			uint32 index = columnIndex + x;
 
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			// Store the index of the source pixel, so warping needs no arithmetic
+			_internalBuffer[index] = yInCylinderCoords * _numColumns + xInCylinderCoords;
 		}
 	}
 }
@@ -42,7 +42,7 @@ public:
 
 private:
 	uint _numColumns, _numRows;
-	Common::Point *_internalBuffer;
+	uint32 *_internalBuffer; ///< For every pixel, the index of the source pixel it shows
 	RenderState _renderState;
 
 	struct {
@@ -136,6 +136,8 @@ private:
 	int _ascent, _descent;
 
 	struct Glyph {
+		Glyph() : xOffset(0), yOffset(0), advance(0), slot(0) {}
+
 		Surface image;
 		int xOffset, yOffset;
 		int advance;
@@ -143,10 +145,15 @@ private:
 	};
 
 	bool cacheGlyph(Glyph &glyph, uint32 chr) const;
+
+	// The first 256 characters are looked up directly, everything above is
+	// cached on demand. Characters the font lacks are remembered with an
+	// empty slot, so we do not ask FreeType for them over and over again.
+	Glyph _latin1Glyphs[256];
 	typedef Common::HashMap<uint32, Glyph> GlyphCache;
 	mutable GlyphCache _glyphs;
 	bool _allowLateCaching;
-	void assureCached(uint32 chr) const;
+	const Glyph *findGlyph(uint32 chr) const;
 
 	Common::SeekableReadStream *readTTFTable(FT_ULong tag) const;
 
@@ -172,6 +179,9 @@ TTFFont::~TTFFont() {
 		delete[] _ttfFile;
 		_ttfFile = 0;
 
+		for (uint i = 0; i < ARRAYSIZE(_latin1Glyphs); ++i)
+			_latin1Glyphs[i].image.free();
+
 		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i)
 			i->_value.image.free();
 
@@ -248,15 +258,15 @@ bool TTFFont::load(Common::SeekableReadStream &stream, int size, TTFSizeMode siz
 	_width = ftCeil26_6(FT_MulFix(_face->max_advance_width, _face->size->metrics.x_scale));
 	_height = _ascent - _descent + 1;
 
+	uint numGlyphs = 0;
 	if (!mapping) {
 		// Allow loading of all unicode characters.
 		_allowLateCaching = true;
 
 		// Load all ISO-8859-1 characters.
 		for (uint i = 0; i < 256; ++i) {
-			if (!cacheGlyph(_glyphs[i], i)) {
-				_glyphs.erase(i);
-			}
+			if (cacheGlyph(_latin1Glyphs[i], i))
+				++numGlyphs;
 		}
 	} else {
 		// We have a fixed map of characters do not load more later.
@@ -267,15 +277,15 @@ bool TTFFont::load(Common::SeekableReadStream &stream, int size, TTFSizeMode siz
 			const bool isRequired = (mapping[i] & 0x80000000) != 0;
 			// Check whether loading an important glyph fails and error out if
 			// that is the case.
-			if (!cacheGlyph(_glyphs[i], unicode)) {
-				_glyphs.erase(i);
-				if (isRequired)
-					return false;
+			if (cacheGlyph(_latin1Glyphs[i], unicode)) {
+				++numGlyphs;
+			} else if (isRequired) {
+				return false;
 			}
 		}
 	}
 
-	_initialized = (_glyphs.size() != 0);
+	_initialized = (numGlyphs != 0);
 	return _initialized;
 }
 
@@ -408,55 +418,38 @@ int TTFFont::getMaxCharWidth() const {
 }
 
 int TTFFont::getCharWidth(uint32 chr) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
+	const Glyph *glyph = findGlyph(chr);
+	if (!glyph)
 		return 0;
 	else
-		return glyphEntry->_value.advance;
+		return glyph->advance;
 }
 
 int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 	if (!_hasKerning)
 		return 0;
 
-	assureCached(left);
-	assureCached(right);
-
-	FT_UInt leftGlyph, rightGlyph;
-	GlyphCache::const_iterator glyphEntry;
-
-	glyphEntry = _glyphs.find(left);
-	if (glyphEntry != _glyphs.end()) {
-		leftGlyph = glyphEntry->_value.slot;
-	} else {
-		return 0;
-	}
-
-	glyphEntry = _glyphs.find(right);
-	if (glyphEntry != _glyphs.end()) {
-		rightGlyph = glyphEntry->_value.slot;
-	} else {
+	const Glyph *leftGlyph = findGlyph(left);
+	if (!leftGlyph)
 		return 0;
-	}
 
-	if (!leftGlyph || !rightGlyph)
+	const Glyph *rightGlyph = findGlyph(right);
+	if (!rightGlyph)
 		return 0;
 
 	FT_Vector kerningVector;
-	FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
+	FT_Get_Kerning(_face, leftGlyph->slot, rightGlyph->slot, FT_KERNING_DEFAULT, &kerningVector);
 	return (kerningVector.x / 64);
 }
 
 Common::Rect TTFFont::getBoundingBox(uint32 chr) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end()) {
+	const Glyph *glyph = findGlyph(chr);
+	if (!glyph) {
 		return Common::Rect();
 	} else {
-		const int xOffset = glyphEntry->_value.xOffset;
-		const int yOffset = glyphEntry->_value.yOffset;
-		const Graphics::Surface &image = glyphEntry->_value.image;
+		const int xOffset = glyph->xOffset;
+		const int yOffset = glyph->yOffset;
+		const Graphics::Surface &image = glyph->image;
 		return Common::Rect(xOffset, yOffset, xOffset + image.w, yOffset + image.h);
 	}
 }
@@ -500,12 +493,11 @@ void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos, const i
 } // End of anonymous namespace
 
 void TTFFont::drawChar(Surface *dst, uint32 chr, int x, int y, uint32 color) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
+	const Glyph *glyphPtr = findGlyph(chr);
+	if (!glyphPtr)
 		return;
 
-	const Glyph &glyph = glyphEntry->_value;
+	const Glyph &glyph = *glyphPtr;
 
 	x += glyph.xOffset;
 	y += glyph.yOffset;
@@ -577,8 +569,6 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	if (!slot)
 		return false;
 
-	glyph.slot = slot;
-
 	// We use the light target and render mode to improve the looks of the
 	// glyphs. It is most noticable in FreeSansBold.ttf, where otherwise the
 	// 't' glyph looks like it is cut off on the right side.
@@ -644,18 +634,29 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 		return false;
 	}
 
+	// Only mark the glyph as valid once it has been fully rendered.
+	glyph.slot = slot;
 	return true;
 }
 
-void TTFFont::assureCached(uint32 chr) const {
-	if (!chr || !_allowLateCaching || _glyphs.contains(chr)) {
-		return;
+const TTFFont::Glyph *TTFFont::findGlyph(uint32 chr) const {
+	if (chr < ARRAYSIZE(_latin1Glyphs)) {
+		const Glyph &glyph = _latin1Glyphs[chr];
+		return glyph.slot ? &glyph : nullptr;
 	}
 
-	Glyph newGlyph;
-	if (cacheGlyph(newGlyph, chr)) {
-		_glyphs[chr] = newGlyph;
-	}
+	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
+	if (glyphEntry != _glyphs.end())
+		return glyphEntry->_value.slot ? &glyphEntry->_value : nullptr;
+
+	if (!_allowLateCaching)
+		return nullptr;
+
+	Glyph &newGlyph = _glyphs[chr];
+	if (!cacheGlyph(newGlyph, chr))
+		return nullptr;
+
+	return &newGlyph;
 }
 
 Font *loadTTFFont(Common::SeekableReadStream &stream, int size, TTFSizeMode sizeMode, uint dpi, TTFRenderMode renderMode, const uint32 *mapping) {
@@ -253,8 +253,8 @@ void ManagedSurface::transBlitFrom(const Surface &src, const Common::Rect &srcRe
 		destPos.x + srcRect.width(), destPos.y + srcRect.height()), transColor, flipped, overrideColor);
 }
 
-template<typename TSRC, typename TDEST>
-void transBlit(const Surface &src, const Common::Rect &srcRect, Surface &dest, const Common::Rect &destRect, TSRC transColor, bool flipped, uint overrideColor, uint srcAlpha) {
+template<typename TSRC, typename TDEST, bool isSameFormat>
+void transBlitT(const Surface &src, const Common::Rect &srcRect, Surface &dest, const Common::Rect &destRect, TSRC transColor, bool flipped, uint overrideColor, uint srcAlpha) {
 	int scaleX = SCALE_THRESHOLD * srcRect.width() / destRect.width();
 	int scaleY = SCALE_THRESHOLD * srcRect.height() / destRect.height();
 	const Graphics::PixelFormat &srcFormat = src.format;
@@ -263,23 +263,27 @@ void transBlit(const Surface &src, const Common::Rect &srcRect, Surface &dest, c
 	byte rDest, gDest, bDest;
 	double alpha;
 
+	// Clip the drawn area against the destination surface once up front,
+	// rather than checking every single pixel against it
+	const int destLeft = MAX<int>(destRect.left, 0);
+	const int destRight = MIN<int>(destRect.right, dest.w);
+	const int destTop = MAX<int>(destRect.top, 0);
+	const int destBottom = MIN<int>(destRect.bottom, dest.h);
+	if (destLeft >= destRight)
+		return;
+
 	// Loop through drawing output lines
-	for (int destY = destRect.top, scaleYCtr = 0; destY < destRect.bottom; ++destY, scaleYCtr += scaleY) {
-		if (destY < 0 || destY >= dest.h)
-			continue;
+	for (int destY = destTop, scaleYCtr = (destTop - destRect.top) * scaleY; destY < destBottom; ++destY, scaleYCtr += scaleY) {
 		const TSRC *srcLine = (const TSRC *)src.getBasePtr(srcRect.left, scaleYCtr / SCALE_THRESHOLD + srcRect.top);
 		TDEST *destLine = (TDEST *)dest.getBasePtr(destRect.left, destY);
 
 		// Loop through drawing the pixels of the row
-		for (int destX = destRect.left, xCtr = 0, scaleXCtr = 0; destX < destRect.right; ++destX, ++xCtr, scaleXCtr += scaleX) {
-			if (destX < 0 || destX >= dest.w)
-				continue;
-
+		for (int destX = destLeft, xCtr = destLeft - destRect.left, scaleXCtr = xCtr * scaleX; destX < destRight; ++destX, ++xCtr, scaleXCtr += scaleX) {
 			TSRC srcVal = srcLine[flipped ? src.w - scaleXCtr / SCALE_THRESHOLD - 1 : scaleXCtr / SCALE_THRESHOLD];
 			if (srcVal == transColor)
 				continue;
 
-			if (srcFormat == destFormat && srcAlpha == 0xff) {
+			if (isSameFormat) {
 				// Matching formats, so we can do a straight copy
 				destLine[xCtr] = overrideColor ? overrideColor : srcVal;
 			} else {
@@ -313,6 +317,16 @@ void transBlit(const Surface &src, const Common::Rect &srcRect, Surface &dest, c
 	}
 }
 
+template<typename TSRC, typename TDEST>
+void transBlit(const Surface &src, const Common::Rect &srcRect, Surface &dest, const Common::Rect &destRect, TSRC transColor, bool flipped, uint overrideColor, uint srcAlpha) {
+	// Select the straight copy kernel once per blit instead of comparing the
+	// pixel formats for every pixel
+	if (src.format == dest.format && srcAlpha == 0xff)
+		transBlitT<TSRC, TDEST, true>(src, srcRect, dest, destRect, transColor, flipped, overrideColor, srcAlpha);
+	else
+		transBlitT<TSRC, TDEST, false>(src, srcRect, dest, destRect, transColor, flipped, overrideColor, srcAlpha);
+}
+
 #define HANDLE_BLIT(SRC_BYTES, DEST_BYTES, SRC_TYPE, DEST_TYPE) \
 	if (src.format.bytesPerPixel == SRC_BYTES && format.bytesPerPixel == DEST_BYTES) \
 		transBlit<SRC_TYPE, DEST_TYPE>(src, srcRect, _innerSurface, destRect, transColor, flipped, overrideColor, srcAlpha); \
@@ -102,298 +102,259 @@ void doBlitOpaqueFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 	}
 }
 
+namespace {
+
 /**
- * Optimized version of doBlit to be used w/binary blitting (blit or no-blit, no blending).
+ * Generic blit loop shared by all the blend modes below.
+ *
+ * The per-pixel work is done by the blender, which is inlined into the loop.
+ * The horizontal source direction is a template parameter, so the common
+ * non-flipped case walks both surfaces with a constant stride, which allows
+ * the compiler to unroll and vectorize the inner loop.
  */
-void doBlitBinaryFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep) {
-
-	byte *in;
-	byte *out;
+template<class Blender, bool flipH>
+void doBlitT(const byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inoStep, const Blender &blender) {
+	const int32 inStep = flipH ? -4 : 4;
 
 	for (uint32 i = 0; i < height; i++) {
-		out = outo;
-		in = ino;
+		const byte *in = ino;
+		byte *out = outo;
 		for (uint32 j = 0; j < width; j++) {
-			uint32 pix = *(uint32 *)in;
-			int a = in[kAIndex];
+			blender.blendPixel(in, out);
 
-			if (a != 0) {   // Full opacity (Any value not exactly 0 is Opaque here)
-				*(uint32 *)out = pix;
-				out[kAIndex] = 0xFF;
-			}
-			out += 4;
 			in += inStep;
+			out += 4;
 		}
 		outo += pitch;
 		ino += inoStep;
 	}
 }
 
+template<class Blender>
+void doBlit(const byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, const Blender &blender) {
+	if (inStep < 0)
+		doBlitT<Blender, true>(ino, outo, width, height, pitch, inoStep, blender);
+	else
+		doBlitT<Blender, false>(ino, outo, width, height, pitch, inoStep, blender);
+}
+
 /**
- * Optimized version of doBlit to be used with alpha blended blitting
- * @param ino a pointer to the input surface
- * @param outo a pointer to the output surface
- * @param width width of the input surface
- * @param height height of the input surface
- * @param pitch pitch of the output surface - that is, width in bytes of every row, usually bpp * width of the TARGET surface (the area we are blitting to might be smaller, do the math)
- * @inStep size in bytes to skip to address each pixel, usually bpp of the source surface
- * @inoStep width in bytes of every row on the *input* surface / kind of like pitch
- * @color colormod in 0xAARRGGBB format - 0xFFFFFFFF for no colormod
+ * Base for the blenders that apply a color modulation.
+ * @color colormod in 0xAARRGGBB format
  */
-void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color) {
-	byte *in;
-	byte *out;
+struct ColorModBlender {
+	ColorModBlender(uint32 color) :
+		ca((color >> kAModShift) & 0xFF), cr((color >> kRModShift) & 0xFF),
+		cg((color >> kGModShift) & 0xFF), cb((color >> kBModShift) & 0xFF) {
+	}
 
-	if (color == 0xffffffff) {
+	byte ca, cr, cg, cb;
+};
 
-		for (uint32 i = 0; i < height; i++) {
-			out = outo;
-			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+struct BinaryBlender {
+	inline void blendPixel(const byte *in, byte *out) const {
+		uint32 pix = READ_UINT32(in);
+		int a = in[kAIndex];
 
-				if (in[kAIndex] != 0) {
-					out[kAIndex] = 255;
-					out[kRIndex] = ((in[kRIndex] * in[kAIndex]) + out[kRIndex] * (255 - in[kAIndex])) >> 8;
-					out[kGIndex] = ((in[kGIndex] * in[kAIndex]) + out[kGIndex] * (255 - in[kAIndex])) >> 8;
-					out[kBIndex] = ((in[kBIndex] * in[kAIndex]) + out[kBIndex] * (255 - in[kAIndex])) >> 8;
-				}
-
-				in += inStep;
-				out += 4;
-			}
-			outo += pitch;
-			ino += inoStep;
+		if (a != 0) {   // Full opacity (Any value not exactly 0 is Opaque here)
+			WRITE_UINT32(out, pix);
+			out[kAIndex] = 0xFF;
 		}
-	} else {
-
-		byte ca = (color >> kAModShift) & 0xFF;
-		byte cr = (color >> kRModShift) & 0xFF;
-		byte cg = (color >> kGModShift) & 0xFF;
-		byte cb = (color >> kBModShift) & 0xFF;
-
-		for (uint32 i = 0; i < height; i++) {
-			out = outo;
-			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+	}
+};
+
+struct AlphaBlender {
+	inline void blendPixel(const byte *in, byte *out) const {
+		if (in[kAIndex] != 0) {
+			out[kAIndex] = 255;
+			out[kRIndex] = ((in[kRIndex] * in[kAIndex]) + out[kRIndex] * (255 - in[kAIndex])) >> 8;
+			out[kGIndex] = ((in[kGIndex] * in[kAIndex]) + out[kGIndex] * (255 - in[kAIndex])) >> 8;
+			out[kBIndex] = ((in[kBIndex] * in[kAIndex]) + out[kBIndex] * (255 - in[kAIndex])) >> 8;
+		}
+	}
+};
 
-				uint32 ina = in[kAIndex] * ca >> 8;
+struct AlphaColorModBlender : public ColorModBlender {
+	AlphaColorModBlender(uint32 color) : ColorModBlender(color) {}
 
-				if (ina != 0) {
-					out[kAIndex] = 255;
-					out[kBIndex] = (out[kBIndex] * (255 - ina) >> 8);
-					out[kGIndex] = (out[kGIndex] * (255 - ina) >> 8);
-					out[kRIndex] = (out[kRIndex] * (255 - ina) >> 8);
+	inline void blendPixel(const byte *in, byte *out) const {
+		uint32 ina = in[kAIndex] * ca >> 8;
 
-					out[kBIndex] = out[kBIndex] + (in[kBIndex] * ina * cb >> 16);
-					out[kGIndex] = out[kGIndex] + (in[kGIndex] * ina * cg >> 16);
-					out[kRIndex] = out[kRIndex] + (in[kRIndex] * ina * cr >> 16);
-				}
+		if (ina != 0) {
+			out[kAIndex] = 255;
+			out[kBIndex] = (out[kBIndex] * (255 - ina) >> 8);
+			out[kGIndex] = (out[kGIndex] * (255 - ina) >> 8);
+			out[kRIndex] = (out[kRIndex] * (255 - ina) >> 8);
 
-				in += inStep;
-				out += 4;
-			}
-			outo += pitch;
-			ino += inoStep;
+			out[kBIndex] = out[kBIndex] + (in[kBIndex] * ina * cb >> 16);
+			out[kGIndex] = out[kGIndex] + (in[kGIndex] * ina * cg >> 16);
+			out[kRIndex] = out[kRIndex] + (in[kRIndex] * ina * cr >> 16);
 		}
 	}
-}
-
-/**
- * Optimized version of doBlit to be used with additive blended blitting
- */
-void doBlitAdditiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color) {
-	byte *in;
-	byte *out;
-
-	if (color == 0xffffffff) {
+};
+
+struct AdditiveBlender {
+	inline void blendPixel(const byte *in, byte *out) const {
+		if (in[kAIndex] != 0) {
+			out[kRIndex] = MIN((in[kRIndex] * in[kAIndex] >> 8) + out[kRIndex], 255);
+			out[kGIndex] = MIN((in[kGIndex] * in[kAIndex] >> 8) + out[kGIndex], 255);
+			out[kBIndex] = MIN((in[kBIndex] * in[kAIndex] >> 8) + out[kBIndex], 255);
+		}
+	}
+};
 
-		for (uint32 i = 0; i < height; i++) {
-			out = outo;
-			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+struct AdditiveColorModBlender : public ColorModBlender {
+	AdditiveColorModBlender(uint32 color) : ColorModBlender(color) {}
 
-				if (in[kAIndex] != 0) {
-					out[kRIndex] = MIN((in[kRIndex] * in[kAIndex] >> 8) + out[kRIndex], 255);
-					out[kGIndex] = MIN((in[kGIndex] * in[kAIndex] >> 8) + out[kGIndex], 255);
-					out[kBIndex] = MIN((in[kBIndex] * in[kAIndex] >> 8) + out[kBIndex], 255);
-				}
+	inline void blendPixel(const byte *in, byte *out) const {
+		uint32 ina = in[kAIndex] * ca >> 8;
 
-				in += inStep;
-				out += 4;
-			}
-			outo += pitch;
-			ino += inoStep;
+		if (cb != 255) {
+			out[kBIndex] = MIN<uint>(out[kBIndex] + ((in[kBIndex] * cb * ina) >> 16), 255u);
+		} else {
+			out[kBIndex] = MIN<uint>(out[kBIndex] + (in[kBIndex] * ina >> 8), 255u);
 		}
-	} else {
 
-		byte ca = (color >> kAModShift) & 0xFF;
-		byte cr = (color >> kRModShift) & 0xFF;
-		byte cg = (color >> kGModShift) & 0xFF;
-		byte cb = (color >> kBModShift) & 0xFF;
-
-		for (uint32 i = 0; i < height; i++) {
-			out = outo;
-			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+		if (cg != 255) {
+			out[kGIndex] = MIN<uint>(out[kGIndex] + ((in[kGIndex] * cg * ina) >> 16), 255u);
+		} else {
+			out[kGIndex] = MIN<uint>(out[kGIndex] + (in[kGIndex] * ina >> 8), 255u);
+		}
 
-				uint32 ina = in[kAIndex] * ca >> 8;
+		if (cr != 255) {
+			out[kRIndex] = MIN<uint>(out[kRIndex] + ((in[kRIndex] * cr * ina) >> 16), 255u);
+		} else {
+			out[kRIndex] = MIN<uint>(out[kRIndex] + (in[kRIndex] * ina >> 8), 255u);
+		}
+	}
+};
+
+struct SubtractiveBlender {
+	inline void blendPixel(const byte *in, byte *out) const {
+		if (in[kAIndex] != 0) {
+			out[kRIndex] = MAX(out[kRIndex] - ((in[kRIndex] * out[kRIndex]) * in[kAIndex] >> 16), 0);
+			out[kGIndex] = MAX(out[kGIndex] - ((in[kGIndex] * out[kGIndex]) * in[kAIndex] >> 16), 0);
+			out[kBIndex] = MAX(out[kBIndex] - ((in[kBIndex] * out[kBIndex]) * in[kAIndex] >> 16), 0);
+		}
+	}
+};
 
-				if (cb != 255) {
-					out[kBIndex] = MIN<uint>(out[kBIndex] + ((in[kBIndex] * cb * ina) >> 16), 255u);
-				} else {
-					out[kBIndex] = MIN<uint>(out[kBIndex] + (in[kBIndex] * ina >> 8), 255u);
-				}
+struct SubtractiveColorModBlender : public ColorModBlender {
+	SubtractiveColorModBlender(uint32 color) : ColorModBlender(color) {}
 
-				if (cg != 255) {
-					out[kGIndex] = MIN<uint>(out[kGIndex] + ((in[kGIndex] * cg * ina) >> 16), 255u);
-				} else {
-					out[kGIndex] = MIN<uint>(out[kGIndex] + (in[kGIndex] * ina >> 8), 255u);
-				}
+	inline void blendPixel(const byte *in, byte *out) const {
+		out[kAIndex] = 255;
+		if (cb != 255) {
+			out[kBIndex] = MAX(out[kBIndex] - ((in[kBIndex] * cb  * (out[kBIndex]) * in[kAIndex]) >> 24), 0);
+		} else {
+			out[kBIndex] = MAX(out[kBIndex] - (in[kBIndex] * (out[kBIndex]) * in[kAIndex] >> 16), 0);
+		}
 
-				if (cr != 255) {
-					out[kRIndex] = MIN<uint>(out[kRIndex] + ((in[kRIndex] * cr * ina) >> 16), 255u);
-				} else {
-					out[kRIndex] = MIN<uint>(out[kRIndex] + (in[kRIndex] * ina >> 8), 255u);
-				}
+		if (cg != 255) {
+			out[kGIndex] = MAX(out[kGIndex] - ((in[kGIndex] * cg  * (out[kGIndex]) * in[kAIndex]) >> 24), 0);
+		} else {
+			out[kGIndex] = MAX(out[kGIndex] - (in[kGIndex] * (out[kGIndex]) * in[kAIndex] >> 16), 0);
+		}
 
-				in += inStep;
-				out += 4;
-			}
-			outo += pitch;
-			ino += inoStep;
+		if (cr != 255) {
+			out[kRIndex] = MAX(out[kRIndex] - ((in[kRIndex] * cr * (out[kRIndex]) * in[kAIndex]) >> 24), 0);
+		} else {
+			out[kRIndex] = MAX(out[kRIndex] - (in[kRIndex] * (out[kRIndex]) * in[kAIndex] >> 16), 0);
 		}
 	}
-}
-
-/**
- * Optimized version of doBlit to be used with subtractive blended blitting
- */
-void doBlitSubtractiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color) {
-	byte *in;
-	byte *out;
+};
+
+struct MultiplyBlender {
+	inline void blendPixel(const byte *in, byte *out) const {
+		if (in[kAIndex] != 0) {
+			out[kRIndex] = MIN((in[kRIndex] * in[kAIndex] >> 8) * out[kRIndex] >> 8, 255);
+			out[kGIndex] = MIN((in[kGIndex] * in[kAIndex] >> 8) * out[kGIndex] >> 8, 255);
+			out[kBIndex] = MIN((in[kBIndex] * in[kAIndex] >> 8) * out[kBIndex] >> 8, 255);
+		}
+	}
+};
 
-	if (color == 0xffffffff) {
+struct MultiplyColorModBlender : public ColorModBlender {
+	MultiplyColorModBlender(uint32 color) : ColorModBlender(color) {}
 
-		for (uint32 i = 0; i < height; i++) {
-			out = outo;
-			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+	inline void blendPixel(const byte *in, byte *out) const {
+		uint32 ina = in[kAIndex] * ca >> 8;
 
-				if (in[kAIndex] != 0) {
-					out[kRIndex] = MAX(out[kRIndex] - ((in[kRIndex] * out[kRIndex]) * in[kAIndex] >> 16), 0);
-					out[kGIndex] = MAX(out[kGIndex] - ((in[kGIndex] * out[kGIndex]) * in[kAIndex] >> 16), 0);
-					out[kBIndex] = MAX(out[kBIndex] - ((in[kBIndex] * out[kBIndex]) * in[kAIndex] >> 16), 0);
-				}
+		if (cb != 255) {
+			out[kBIndex] = MIN<uint>(out[kBIndex] * ((in[kBIndex] * cb * ina) >> 16) >> 8, 255u);
+		} else {
+			out[kBIndex] = MIN<uint>(out[kBIndex] * (in[kBIndex] * ina >> 8) >> 8, 255u);
+		}
 
-				in += inStep;
-				out += 4;
-			}
-			outo += pitch;
-			ino += inoStep;
+		if (cg != 255) {
+			out[kGIndex] = MIN<uint>(out[kGIndex] * ((in[kGIndex] * cg * ina) >> 16) >> 8, 255u);
+		} else {
+			out[kGIndex] = MIN<uint>(out[kGIndex] * (in[kGIndex] * ina >> 8) >> 8, 255u);
 		}
-	} else {
 
-		byte cr = (color >> kRModShift) & 0xFF;
-		byte cg = (color >> kGModShift) & 0xFF;
-		byte cb = (color >> kBModShift) & 0xFF;
+		if (cr != 255) {
+			out[kRIndex] = MIN<uint>(out[kRIndex] * ((in[kRIndex] * cr * ina) >> 16) >> 8, 255u);
+		} else {
+			out[kRIndex] = MIN<uint>(out[kRIndex] * (in[kRIndex] * ina >> 8) >> 8, 255u);
+		}
+	}
+};
 
-		for (uint32 i = 0; i < height; i++) {
-			out = outo;
-			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+} // End of anonymous namespace
 
-				out[kAIndex] = 255;
-				if (cb != 255) {
-					out[kBIndex] = MAX(out[kBIndex] - ((in[kBIndex] * cb  * (out[kBIndex]) * in[kAIndex]) >> 24), 0);
-				} else {
-					out[kBIndex] = MAX(out[kBIndex] - (in[kBIndex] * (out[kBIndex]) * in[kAIndex] >> 16), 0);
-				}
+/**
+ * Optimized version of doBlit to be used w/binary blitting (blit or no-blit, no blending).
+ */
+void doBlitBinaryFast(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep) {
+	doBlit(ino, outo, width, height, pitch, inStep, inoStep, BinaryBlender());
+}
 
-				if (cg != 255) {
-					out[kGIndex] = MAX(out[kGIndex] - ((in[kGIndex] * cg  * (out[kGIndex]) * in[kAIndex]) >> 24), 0);
-				} else {
-					out[kGIndex] = MAX(out[kGIndex] - (in[kGIndex] * (out[kGIndex]) * in[kAIndex] >> 16), 0);
-				}
+/**
+ * Optimized version of doBlit to be used with alpha blended blitting
+ * @param ino a pointer to the input surface
+ * @param outo a pointer to the output surface
+ * @param width width of the input surface
+ * @param height height of the input surface
+ * @param pitch pitch of the output surface - that is, width in bytes of every row, usually bpp * width of the TARGET surface (the area we are blitting to might be smaller, do the math)
+ * @inStep size in bytes to skip to address each pixel, usually bpp of the source surface
+ * @inoStep width in bytes of every row on the *input* surface / kind of like pitch
+ * @color colormod in 0xAARRGGBB format - 0xFFFFFFFF for no colormod
+ */
+void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color) {
+	if (color == 0xffffffff)
+		doBlit(ino, outo, width, height, pitch, inStep, inoStep, AlphaBlender());
+	else
+		doBlit(ino, outo, width, height, pitch, inStep, inoStep, AlphaColorModBlender(color));
+}
 
-				if (cr != 255) {
-					out[kRIndex] = MAX(out[kRIndex] - ((in[kRIndex] * cr * (out[kRIndex]) * in[kAIndex]) >> 24), 0);
-				} else {
-					out[kRIndex] = MAX(out[kRIndex] - (in[kRIndex] * (out[kRIndex]) * in[kAIndex] >> 16), 0);
-				}
+/**
+ * Optimized version of doBlit to be used with additive blended blitting
+ */
+void doBlitAdditiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color) {
+	if (color == 0xffffffff)
+		doBlit(ino, outo, width, height, pitch, inStep, inoStep, AdditiveBlender());
+	else
+		doBlit(ino, outo, width, height, pitch, inStep, inoStep, AdditiveColorModBlender(color));
+}
 
-				in += inStep;
-				out += 4;
-			}
-			outo += pitch;
-			ino += inoStep;
-		}
-	}
+/**
+ * Optimized version of doBlit to be used with subtractive blended blitting
+ */
+void doBlitSubtractiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color) {
+	if (color == 0xffffffff)
+		doBlit(ino, outo, width, height, pitch, inStep, inoStep, SubtractiveBlender());
+	else
+		doBlit(ino, outo, width, height, pitch, inStep, inoStep, SubtractiveColorModBlender(color));
 }
 
 /**
  * Optimized version of doBlit to be used with multiply blended blitting
  */
 void doBlitMultiplyBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep, uint32 color) {
-	byte *in;
-	byte *out;
-
-	if (color == 0xffffffff) {
-		for (uint32 i = 0; i < height; i++) {
-			out = outo;
-			in = ino;
-			for (uint32 j = 0; j < width; j++) {
-
-				if (in[kAIndex] != 0) {
-					out[kRIndex] = MIN((in[kRIndex] * in[kAIndex] >> 8) * out[kRIndex] >> 8, 255);
-					out[kGIndex] = MIN((in[kGIndex] * in[kAIndex] >> 8) * out[kGIndex] >> 8, 255);
-					out[kBIndex] = MIN((in[kBIndex] * in[kAIndex] >> 8) * out[kBIndex] >> 8, 255);
-				}
-
-				in += inStep;
-				out += 4;
-			}
-			outo += pitch;
-			ino += inoStep;
-		}
-	} else {
-		byte ca = (color >> kAModShift) & 0xFF;
-		byte cr = (color >> kRModShift) & 0xFF;
-		byte cg = (color >> kGModShift) & 0xFF;
-		byte cb = (color >> kBModShift) & 0xFF;
-
-		for (uint32 i = 0; i < height; i++) {
-			out = outo;
-			in = ino;
-			for (uint32 j = 0; j < width; j++) {
-
-				uint32 ina = in[kAIndex] * ca >> 8;
-
-				if (cb != 255) {
-					out[kBIndex] = MIN<uint>(out[kBIndex] * ((in[kBIndex] * cb * ina) >> 16) >> 8, 255u);
-				} else {
-					out[kBIndex] = MIN<uint>(out[kBIndex] * (in[kBIndex] * ina >> 8) >> 8, 255u);
-				}
-
-				if (cg != 255) {
-					out[kGIndex] = MIN<uint>(out[kGIndex] * ((in[kGIndex] * cg * ina) >> 16) >> 8, 255u);
-				} else {
-					out[kGIndex] = MIN<uint>(out[kGIndex] * (in[kGIndex] * ina >> 8) >> 8, 255u);
-				}
-
-				if (cr != 255) {
-					out[kRIndex] = MIN<uint>(out[kRIndex] * ((in[kRIndex] * cr * ina) >> 16) >> 8, 255u);
-				} else {
-					out[kRIndex] = MIN<uint>(out[kRIndex] * (in[kRIndex] * ina >> 8) >> 8, 255u);
-				}
-
-				in += inStep;
-				out += 4;
-			}
-			outo += pitch;
-			ino += inoStep;
-		}
-	}
-
+	if (color == 0xffffffff)
+		doBlit(ino, outo, width, height, pitch, inStep, inoStep, MultiplyBlender());
+	else
+		doBlit(ino, outo, width, height, pitch, inStep, inoStep, MultiplyColorModBlender(color));
 }
 
 Common::Rect TransparentSurface::blit(Graphics::Surface &target, int posX, int posY, int flipping, Common::Rect *pPartRect, uint color, int width, int height, TSpriteBlendMode blendMode) {
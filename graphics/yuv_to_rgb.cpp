@@ -86,6 +86,10 @@
 #include "graphics/surface.h"
 #include "graphics/yuv_to_rgb.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace Common {
 DECLARE_SINGLETON(Graphics::YUVToRGBManager);
 }
@@ -242,6 +246,177 @@ void YUVToRGBManager::convert444(Graphics::Surface *dst, YUVToRGBManager::Lumina
 		convertYUV444ToRGB<uint32>((byte *)dst->getPixels(), dst->pitch, lookup, _colorTab, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
 }
 
+#ifdef __SSE2__
+
+namespace {
+
+/**
+ * Packs eight channel intensities per color into pixels of a given format,
+ * producing exactly the values the YUVToRGBLookup tables would.
+ */
+struct PixelPackerSSE2 {
+	PixelPackerSSE2(const Graphics::PixelFormat &format) {
+		rLoss = _mm_cvtsi32_si128(format.rLoss);
+		gLoss = _mm_cvtsi32_si128(format.gLoss);
+		bLoss = _mm_cvtsi32_si128(format.bLoss);
+		rShift = _mm_cvtsi32_si128(format.rShift);
+		gShift = _mm_cvtsi32_si128(format.gShift);
+		bShift = _mm_cvtsi32_si128(format.bShift);
+		alpha = format.RGBToColor(0, 0, 0);
+
+		// 32bpp formats with byte aligned 8 bit channels can be written by
+		// interleaving bytes rather than shifting every channel into place
+		bytePacked = format.bytesPerPixel == 4 && !format.rLoss && !format.gLoss && !format.bLoss
+			&& !(format.rShift & 7) && !(format.gShift & 7) && !(format.bShift & 7)
+			&& (format.aLoss == 8 || (format.aLoss == 0 && !(format.aShift & 7)));
+		rByte = format.rShift >> 3;
+		gByte = format.gShift >> 3;
+		bByte = format.bShift >> 3;
+		aByte = 6 - rByte - gByte - bByte;
+		alphaBytes = _mm_set1_epi8(format.aLoss ? 0 : (char)0xFF);
+		if (aByte < 0 || aByte > 3)
+			bytePacked = false;
+	}
+
+	__m128i rLoss, gLoss, bLoss;
+	__m128i rShift, gShift, bShift;
+	uint32 alpha;
+
+	bool bytePacked;
+	int rByte, gByte, bByte, aByte;
+	__m128i alphaBytes;
+};
+
+/**
+ * Clamp eight int16 channel values the same way the lookup tables do, and
+ * apply the luminance scale. The ITU scale maps [16, 235] to [0, 255] with
+ * (c - 16) * 255 / 219, which is computed as (c - 16) * 2 * 38155 / 2^16.
+ * That is exact for all values in the range.
+ */
+inline __m128i clampChannelSSE2(__m128i val, YUVToRGBManager::LuminanceScale scale) {
+	if (scale == YUVToRGBManager::kScaleFull)
+		return _mm_max_epi16(_mm_min_epi16(val, _mm_set1_epi16(255)), _mm_setzero_si128());
+
+	val = _mm_max_epi16(_mm_min_epi16(val, _mm_set1_epi16(235)), _mm_set1_epi16(16));
+	val = _mm_slli_epi16(_mm_sub_epi16(val, _mm_set1_epi16(16)), 1);
+	return _mm_mulhi_epu16(val, _mm_set1_epi16((int16)38155));
+}
+
+template<typename PixelInt>
+void storePixelsSSE2(byte *dst, __m128i r, __m128i g, __m128i b, const PixelPackerSSE2 &packer);
+
+template<>
+inline void storePixelsSSE2<uint16>(byte *dst, __m128i r, __m128i g, __m128i b, const PixelPackerSSE2 &packer) {
+	__m128i pixels = _mm_set1_epi16((uint16)packer.alpha);
+	pixels = _mm_or_si128(pixels, _mm_sll_epi16(_mm_srl_epi16(r, packer.rLoss), packer.rShift));
+	pixels = _mm_or_si128(pixels, _mm_sll_epi16(_mm_srl_epi16(g, packer.gLoss), packer.gShift));
+	pixels = _mm_or_si128(pixels, _mm_sll_epi16(_mm_srl_epi16(b, packer.bLoss), packer.bShift));
+	_mm_storeu_si128((__m128i *)dst, pixels);
+}
+
+template<>
+inline void storePixelsSSE2<uint32>(byte *dst, __m128i r, __m128i g, __m128i b, const PixelPackerSSE2 &packer) {
+	if (packer.bytePacked) {
+		__m128i bytes[4];
+		bytes[packer.rByte] = _mm_packus_epi16(r, r);
+		bytes[packer.gByte] = _mm_packus_epi16(g, g);
+		bytes[packer.bByte] = _mm_packus_epi16(b, b);
+		bytes[packer.aByte] = packer.alphaBytes;
+
+		const __m128i lo = _mm_unpacklo_epi8(bytes[0], bytes[1]);
+		const __m128i hi = _mm_unpacklo_epi8(bytes[2], bytes[3]);
+		_mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi16(lo, hi));
+		_mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi16(lo, hi));
+		return;
+	}
+
+	r = _mm_srl_epi16(r, packer.rLoss);
+	g = _mm_srl_epi16(g, packer.gLoss);
+	b = _mm_srl_epi16(b, packer.bLoss);
+
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alpha = _mm_set1_epi32(packer.alpha);
+
+	__m128i lo = alpha;
+	lo = _mm_or_si128(lo, _mm_sll_epi32(_mm_unpacklo_epi16(r, zero), packer.rShift));
+	lo = _mm_or_si128(lo, _mm_sll_epi32(_mm_unpacklo_epi16(g, zero), packer.gShift));
+	lo = _mm_or_si128(lo, _mm_sll_epi32(_mm_unpacklo_epi16(b, zero), packer.bShift));
+	_mm_storeu_si128((__m128i *)dst, lo);
+
+	__m128i hi = alpha;
+	hi = _mm_or_si128(hi, _mm_sll_epi32(_mm_unpackhi_epi16(r, zero), packer.rShift));
+	hi = _mm_or_si128(hi, _mm_sll_epi32(_mm_unpackhi_epi16(g, zero), packer.gShift));
+	hi = _mm_or_si128(hi, _mm_sll_epi32(_mm_unpackhi_epi16(b, zero), packer.bShift));
+	_mm_storeu_si128((__m128i *)(dst + 16), hi);
+}
+
+/**
+ * Compute the chroma contribution for eight chroma samples, matching the
+ * (truncated) values in the YUVToRGBManager color tables exactly. The
+ * constant is the table's factor in 16 bit fixed point, scaled up by
+ * 2^preShift for factors larger than one.
+ */
+template<int preShift, uint16 factor, bool negative>
+inline __m128i chromaOffsetSSE2(__m128i c, __m128i sign) {
+	// Work on the absolute value to get truncation towards zero
+	const __m128i abs = _mm_sub_epi16(_mm_xor_si128(c, sign), sign);
+	const __m128i val = _mm_mulhi_epu16(_mm_slli_epi16(abs, preShift), _mm_set1_epi16((int16)factor));
+
+	if (negative)
+		sign = _mm_xor_si128(sign, _mm_set1_epi16(-1));
+
+	return _mm_sub_epi16(_mm_xor_si128(val, sign), sign);
+}
+
+/**
+ * Convert two rows of a YUV420 image, sixteen pixels wide per step. count is
+ * the number of chroma samples to process and must be a multiple of eight.
+ */
+template<typename PixelInt>
+void convertYUV420RowsSSE2(byte *dstPtr, int dstPitch, const PixelPackerSSE2 &packer, YUVToRGBManager::LuminanceScale scale, const byte *ySrc, int yPitch, const byte *uSrc, const byte *vSrc, int count) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i bias = _mm_set1_epi16(128);
+
+	for (int w = 0; w < count; w += 8) {
+		const __m128i cr = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)vSrc), zero), bias);
+		const __m128i cb = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)uSrc), zero), bias);
+		const __m128i crSign = _mm_srai_epi16(cr, 15);
+		const __m128i cbSign = _mm_srai_epi16(cb, 15);
+
+		// 0.419 / 0.299, -0.299 / 0.419, -0.114 / 0.331 and 0.587 / 0.331
+		const __m128i crR = chromaOffsetSSE2<1, 45876, false>(cr, crSign);
+		const __m128i crbG = _mm_add_epi16(chromaOffsetSSE2<0, 46735, true>(cr, crSign), chromaOffsetSSE2<0, 22562, true>(cb, cbSign));
+		const __m128i cbB = chromaOffsetSSE2<1, 58109, false>(cb, cbSign);
+
+		// Each chroma sample covers two horizontal pixels
+		const __m128i rOffset[2] = { _mm_unpacklo_epi16(crR, crR), _mm_unpackhi_epi16(crR, crR) };
+		const __m128i gOffset[2] = { _mm_unpacklo_epi16(crbG, crbG), _mm_unpackhi_epi16(crbG, crbG) };
+		const __m128i bOffset[2] = { _mm_unpacklo_epi16(cbB, cbB), _mm_unpackhi_epi16(cbB, cbB) };
+
+		for (int row = 0; row < 2; row++) {
+			const __m128i yRow = _mm_loadu_si128((const __m128i *)(ySrc + row * yPitch));
+			const __m128i y[2] = { _mm_unpacklo_epi8(yRow, zero), _mm_unpackhi_epi8(yRow, zero) };
+
+			for (int half = 0; half < 2; half++) {
+				storePixelsSSE2<PixelInt>(dstPtr + row * dstPitch + half * 8 * sizeof(PixelInt),
+					clampChannelSSE2(_mm_add_epi16(y[half], rOffset[half]), scale),
+					clampChannelSSE2(_mm_add_epi16(y[half], gOffset[half]), scale),
+					clampChannelSSE2(_mm_add_epi16(y[half], bOffset[half]), scale),
+					packer);
+			}
+		}
+
+		ySrc += 16;
+		uSrc += 8;
+		vSrc += 8;
+		dstPtr += 16 * sizeof(PixelInt);
+	}
+}
+
+} // End of anonymous namespace
+
+#endif
+
 template<typename PixelInt>
 void convertYUV420ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup, int16 *colorTab, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
 	int halfHeight = yHeight >> 1;
@@ -254,8 +429,24 @@ void convertYUV420ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 	const int16 *Cb_b_tab = Cb_g_tab + 256;
 	const uint32 *rgbToPix = lookup->getRGBToPix();
 
+#ifdef __SSE2__
+	const PixelPackerSSE2 packer(lookup->getFormat());
+	const int vectorWidth = halfWidth & ~7;
+#endif
+
 	for (int h = 0; h < halfHeight; h++) {
-		for (int w = 0; w < halfWidth; w++) {
+		int w = 0;
+
+#ifdef __SSE2__
+		convertYUV420RowsSSE2<PixelInt>(dstPtr, dstPitch, packer, lookup->getScale(), ySrc, yPitch, uSrc, vSrc, vectorWidth);
+		ySrc += vectorWidth * 2;
+		uSrc += vectorWidth;
+		vSrc += vectorWidth;
+		dstPtr += vectorWidth * 2 * sizeof(PixelInt);
+		w = vectorWidth;
+#endif
+
+		for (; w < halfWidth; w++) {
 			const uint32 *L;
 
 			int16 cr_r  = Cr_r_tab[*vSrc];
@@ -73,6 +73,12 @@ public:
 	 */
 	bool isActive() const { return _isActive; }
 
+	/**
+	 * Return true if the debugger has been attached, i.e. if one of the
+	 * next calls to onFrame() will activate it.
+	 */
+	bool isAttached() const { return _frameCountdown > 0; }
+
 protected:
 	typedef Common::Functor2<int, const char **, bool> Debuglet;
 
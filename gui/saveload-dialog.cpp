@@ -176,6 +176,9 @@ void SaveLoadChooserDialog::close() {
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 	CloudMan.setSyncTarget(nullptr); //not that dialog, at least
 #endif
+	// The chooser outlives the dialog, don't keep the descriptors and their
+	// thumbnails around until the next time it's shown
+	_saveMetaInfoCache.clear();
 	Dialog::close();
 }
 
@@ -296,6 +299,7 @@ void SaveLoadChooserDialog::updateSaveList() {
 void SaveLoadChooserDialog::listSaves() {
 	if (!_metaEngine) return; //very strange
 	_saveList = _metaEngine->listSaves(_target.c_str());
+	_saveMetaInfoCache.clear();
 
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
 	//if there is Cloud support, add currently synced files as "locked" saves in the list
@@ -325,6 +329,20 @@ void SaveLoadChooserDialog::listSaves() {
 #endif
 }
 
+SaveStateDescriptor SaveLoadChooserDialog::getSaveMetaInfos(const SaveStateDescriptor &save) {
+	if (save.getLocked())
+		return save;
+
+	const int slot = save.getSaveSlot();
+	SaveMetaInfoCache::const_iterator cached = _saveMetaInfoCache.find(slot);
+	if (cached != _saveMetaInfoCache.end())
+		return cached->_value;
+
+	SaveStateDescriptor desc = _metaEngine->querySaveMetaInfos(_target.c_str(), slot);
+	_saveMetaInfoCache[slot] = desc;
+	return desc;
+}
+
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 void SaveLoadChooserDialog::addChooserButtons() {
 	if (_listButton) {
@@ -553,7 +571,7 @@ void SaveLoadChooserSimple::updateSelection(bool redraw) {
 	_playtime->setLabel(_("No playtime saved"));
 
 	if (selItem >= 0 && _metaInfoSupport) {
-		SaveStateDescriptor desc = (_saveList[selItem].getLocked() ? _saveList[selItem] : _metaEngine->querySaveMetaInfos(_target.c_str(), _saveList[selItem].getSaveSlot()));
+		SaveStateDescriptor desc = getSaveMetaInfos(_saveList[selItem]);
 
 		isDeletable = desc.getDeletableFlag() && _delSupport;
 		isWriteProtected = desc.getWriteProtectedFlag();
@@ -1068,7 +1086,7 @@ void SaveLoadChooserGrid::updateSaves() {
 	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
 		const uint saveSlot = _saveList[i].getSaveSlot();
 
-		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot));
+		SaveStateDescriptor desc = getSaveMetaInfos(_saveList[i]);
 		SlotButton &curButton = _buttons[curNum];
 		curButton.setVisible(true);
 		const Graphics::Surface *thumbnail = desc.getThumbnail();
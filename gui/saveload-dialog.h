@@ -28,6 +28,8 @@
 
 #include "engines/metaengine.h"
 
+#include "common/hashmap.h"
+
 namespace GUI {
 
 #if defined(USE_CLOUD) && defined(USE_LIBCURL)
@@ -110,6 +112,15 @@ protected:
 	*/
 	virtual void listSaves();
 
+	/**
+	 * Get the meta infos for an entry of the saves list.
+	 *
+	 * The MetaEngine is only queried the first time a slot is requested
+	 * after the list was refreshed, since that means opening the save and
+	 * decoding its thumbnail. Locked saves are returned as they are.
+	 */
+	SaveStateDescriptor getSaveMetaInfos(const SaveStateDescriptor &save);
+
 	const bool				_saveMode;
 	const MetaEngine		*_metaEngine;
 	bool					_delSupport;
@@ -121,6 +132,9 @@ protected:
 	bool _dialogWasShown;
 	SaveStateList			_saveList;
 
+	typedef Common::HashMap<int, SaveStateDescriptor> SaveMetaInfoCache;
+	SaveMetaInfoCache		_saveMetaInfoCache;
+
 #ifndef DISABLE_SAVELOADCHOOSER_GRID
 	ButtonWidget *_listButton;
 	ButtonWidget *_gridButton;
@@ -0,0 +1,150 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/fft.h"
+#include "common/rdft.h"
+#include "common/dct.h"
+#include "common/array.h"
+#include "common/util.h"
+
+/**
+ * Checks the FFT, RDFT and DCT against a direct double precision
+ * evaluation of the transforms.
+ */
+class FFTTestSuite : public CxxTest::TestSuite {
+	/** Fill the data with reproducible values in [-1, 1]. */
+	static void fillData(float *data, int count, uint32 seed) {
+		for (int i = 0; i < count; i++) {
+			seed = seed * 1103515245 + 12345;
+			data[i] = ((seed >> 8) & 0xFFFF) / 32767.5f - 1.0f;
+		}
+	}
+
+	/** The maximum error allowed for a transform of 2^bits values in [-1, 1]. */
+	static double maxError(int bits) {
+		return (1 << bits) * 1e-6;
+	}
+
+public:
+	void test_fft() {
+		for (int bits = 2; bits <= 10; bits++) {
+			for (int inverse = 0; inverse < 2; inverse++) {
+				const int n = 1 << bits;
+				Common::Array<Common::Complex> z;
+				z.resize(n);
+				fillData(&z[0].re, n * 2, bits + inverse * 16);
+
+				Common::Array<Common::Complex> in(z);
+
+				Common::FFT fft(bits, inverse);
+				fft.permute(&z[0]);
+				fft.calc(&z[0]);
+
+				// The forward transform uses e^(-2*pi*i*j*k/n)
+				const double sign = inverse ? 1.0 : -1.0;
+
+				double error = 0.0;
+				for (int k = 0; k < n; k++) {
+					double re = 0.0, im = 0.0;
+					for (int j = 0; j < n; j++) {
+						const double angle = sign * 2.0 * M_PI * ((j * k) % n) / n;
+						re += in[j].re * cos(angle) - in[j].im * sin(angle);
+						im += in[j].re * sin(angle) + in[j].im * cos(angle);
+					}
+
+					error = MAX(error, fabs(re - z[k].re));
+					error = MAX(error, fabs(im - z[k].im));
+				}
+
+				TS_ASSERT_LESS_THAN(error, maxError(bits));
+			}
+		}
+	}
+
+	void test_rdft() {
+		for (int bits = 4; bits <= 10; bits++) {
+			const int n = 1 << bits;
+			Common::Array<float> data;
+			data.resize(n);
+			fillData(&data[0], n, bits);
+
+			Common::Array<float> in(data);
+
+			Common::RDFT rdft(bits, Common::RDFT::DFT_R2C);
+			rdft.calc(&data[0]);
+
+			// data[0] and data[1] hold the real DC and Nyquist terms,
+			// followed by the complex terms 1 to n/2 - 1
+			double error = 0.0;
+			for (int k = 0; k <= n / 2; k++) {
+				double re = 0.0, im = 0.0;
+				for (int j = 0; j < n; j++) {
+					const double angle = -2.0 * M_PI * ((j * k) % n) / n;
+					re += in[j] * cos(angle);
+					im += in[j] * sin(angle);
+				}
+
+				if (k == 0) {
+					error = MAX(error, fabs(re - data[0]));
+				} else if (k == n / 2) {
+					error = MAX(error, fabs(re - data[1]));
+				} else {
+					error = MAX(error, fabs(re - data[2 * k]));
+					error = MAX(error, fabs(im - data[2 * k + 1]));
+				}
+			}
+
+			TS_ASSERT_LESS_THAN(error, maxError(bits));
+
+			// The inverse transform restores the input, scaled by n / 2
+			Common::RDFT irdft(bits, Common::RDFT::IDFT_C2R);
+			irdft.calc(&data[0]);
+
+			error = 0.0;
+			for (int j = 0; j < n; j++)
+				error = MAX(error, fabs(in[j] - data[j] * 2.0 / n));
+
+			TS_ASSERT_LESS_THAN(error, maxError(bits));
+		}
+	}
+
+	void test_dct() {
+		for (int bits = 4; bits <= 10; bits++) {
+			const int n = 1 << bits;
+			Common::Array<float> in;
+			in.resize(n);
+			fillData(&in[0], n, bits);
+
+			// DCT-II: X[k] = sum x[j] * cos(pi / n * (j + 1/2) * k)
+			Common::Array<float> data(in);
+			Common::DCT dct2(bits, Common::DCT::DCT_II);
+			dct2.calc(&data[0]);
+
+			double error = 0.0;
+			for (int k = 0; k < n; k++) {
+				double sum = 0.0;
+				for (int j = 0; j < n; j++)
+					sum += in[j] * cos(M_PI / n * (j + 0.5) * k);
+
+				error = MAX(error, fabs(sum - data[k]));
+			}
+
+			TS_ASSERT_LESS_THAN(error, maxError(bits));
+
+			// DCT-III: x[j] = 2 / n * (X[0] / 2 + sum X[k] * cos(pi / n * (j + 1/2) * k))
+			data = in;
+			Common::DCT dct3(bits, Common::DCT::DCT_III);
+			dct3.calc(&data[0]);
+
+			error = 0.0;
+			for (int j = 0; j < n; j++) {
+				double sum = in[0] * 0.5;
+				for (int k = 1; k < n; k++)
+					sum += in[k] * cos(M_PI / n * (j + 0.5) * k);
+
+				error = MAX(error, fabs(sum * 2.0 / n - data[j]));
+			}
+
+			TS_ASSERT_LESS_THAN(error, maxError(bits));
+		}
+	}
+};
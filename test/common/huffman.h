@@ -2,15 +2,118 @@
 #include "common/huffman.h"
 #include "common/bitstream.h"
 #include "common/memstream.h"
+#include "common/array.h"
 
 /**
 * A test suite for the Huffman decoder in common/huffman.h
 * The encoding used comes from the example on the Wikipedia page
 * for Huffman.
-* TODO: It could be improved by generating one at runtime.
+* The round-trip tests generate canonical codebooks at runtime.
 */
 class HuffmanTestSuite : public CxxTest::TestSuite {
+	/** Assign canonical codes to the given code lengths. */
+	static void makeCanonicalCodes(const uint8 *lengths, uint32 codeCount, uint32 *codes) {
+		uint32 code = 0;
+		for (uint8 length = 1; length <= 32; length++) {
+			for (uint32 i = 0; i < codeCount; i++) {
+				if (lengths[i] == length)
+					codes[i] = code++;
+			}
+			code <<= 1;
+		}
+	}
+
+	/**
+	 * Append a code to a bit buffer. For MSB2LSB streams, the code's most
+	 * significant bit is read first, for LSB2MSB streams the least
+	 * significant one. Only matches streams whose byte order follows the
+	 * bit order (8 bit, BE MSB2LSB and LE LSB2MSB).
+	 */
+	static void writeCode(Common::Array<byte> &buffer, uint32 &bitPos, uint32 code, uint8 length, bool msb2lsb) {
+		for (uint8 i = 0; i < length; i++, bitPos++) {
+			if ((bitPos >> 3) >= buffer.size())
+				buffer.push_back(0);
+
+			if (msb2lsb) {
+				if ((code >> (length - 1 - i)) & 1)
+					buffer[bitPos >> 3] |= 0x80 >> (bitPos & 7);
+			} else {
+				if ((code >> i) & 1)
+					buffer[bitPos >> 3] |= 1 << (bitPos & 7);
+			}
+		}
+	}
+
+	template<class BITSTREAM>
+	void roundTrip(const uint8 *lengths, uint32 codeCount) {
+		Common::Array<uint32> codes, symbols;
+		codes.resize(codeCount);
+		symbols.resize(codeCount);
+		makeCanonicalCodes(lengths, codeCount, &codes[0]);
+
+		// LSB2MSB streams read codes starting with the least significant
+		// bit, reverse them to keep the code prefix-free in reading order
+		if (!BITSTREAM::isMSB2LSB())
+			for (uint32 i = 0; i < codeCount; i++)
+				codes[i] = Common::REVERSEBITS(codes[i]) >> (32 - lengths[i]);
+		for (uint32 i = 0; i < codeCount; i++)
+			symbols[i] = 1000 + i * 3;
+
+		// Encode every symbol, followed by every symbol in reverse
+		Common::Array<byte> buffer;
+		uint32 bitPos = 0;
+		for (uint32 i = 0; i < codeCount * 2; i++) {
+			const uint32 index = i < codeCount ? i : (codeCount * 2 - 1 - i);
+			writeCode(buffer, bitPos, codes[index], lengths[index], BITSTREAM::isMSB2LSB());
+		}
+
+		// Pad to whole 32 bit values
+		while (buffer.size() & 3)
+			buffer.push_back(0);
+
+		Common::Huffman<BITSTREAM> h(0, codeCount, &codes[0], lengths, &symbols[0]);
+
+		Common::MemoryReadStream ms(&buffer[0], buffer.size());
+		BITSTREAM bs(ms);
+
+		for (uint32 i = 0; i < codeCount * 2; i++) {
+			const uint32 index = i < codeCount ? i : (codeCount * 2 - 1 - i);
+			TS_ASSERT_EQUALS(h.getSymbol(bs), symbols[index]);
+		}
+
+		TS_ASSERT_EQUALS(bs.pos(), bitPos);
+	}
+
 	public:
+	void test_round_trip_long_codes() {
+		// A complete code with lengths from 1 up to 20 bits, which needs
+		// secondary lookup tables
+		const uint8 lengths[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 20 };
+		const uint32 codeCount = ARRAYSIZE(lengths);
+
+		roundTrip<Common::BitStream8MSB>(lengths, codeCount);
+		roundTrip<Common::BitStream8LSB>(lengths, codeCount);
+		roundTrip<Common::BitStream32LELSB>(lengths, codeCount);
+		roundTrip<Common::BitStream32BEMSB>(lengths, codeCount);
+	}
+
+	void test_round_trip_flat_codes() {
+		// 63 codes of 6 bits, plus 8 codes of 10 bits and 16 of 11 bits
+		// below the last 6 bit prefix: several codes per secondary table
+		Common::Array<uint8> lengths;
+		for (uint32 i = 0; i < 63; i++)
+			lengths.push_back(6);
+		for (uint32 i = 0; i < 8; i++)
+			lengths.push_back(10);
+		for (uint32 i = 0; i < 16; i++)
+			lengths.push_back(11);
+
+		roundTrip<Common::BitStream8MSB>(&lengths[0], lengths.size());
+		roundTrip<Common::BitStream8LSB>(&lengths[0], lengths.size());
+		roundTrip<Common::BitStream16BEMSB>(&lengths[0], lengths.size());
+		roundTrip<Common::BitStream32LELSB>(&lengths[0], lengths.size());
+	}
+
 	void test_get_with_full_symbols() {
 
 		/*
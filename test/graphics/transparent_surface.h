@@ -0,0 +1,80 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/transparent_surface.h"
+
+/**
+ * Golden output tests for the TransparentSurface blit kernels.
+ *
+ * A two pixel sprite, one half transparent and one fully transparent pixel,
+ * is blitted onto a grey background in every blend mode.
+ */
+class TransparentSurfaceTestSuite : public CxxTest::TestSuite {
+	Graphics::PixelFormat _format;
+	Graphics::TransparentSurface _src;
+	Graphics::Surface _dst;
+
+	uint32 blit(uint x, int flipping, uint color, Graphics::TSpriteBlendMode blendMode) {
+		_dst.fillRect(Common::Rect(_dst.w, _dst.h), 0x80808080);
+		_src.blit(_dst, 0, 0, flipping, nullptr, color, -1, -1, blendMode);
+		return *(const uint32 *)_dst.getBasePtr(x, 0);
+	}
+
+	public:
+	void setUp() {
+		_format = Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0);
+		_src.create(2, 1, _format);
+		*(uint32 *)_src.getBasePtr(0, 0) = 0x40800080;
+		*(uint32 *)_src.getBasePtr(1, 0) = 0xFFFFFF00;
+		_dst.create(2, 1, _format);
+	}
+
+	void tearDown() {
+		_src.free();
+		_dst.free();
+	}
+
+	void test_blit_normal() {
+		TS_ASSERT_EQUALS(blit(0, Graphics::FLIP_NONE, 0xFFFFFFFF, Graphics::BLEND_NORMAL), 0x5F7F3FFFu);
+		TS_ASSERT_EQUALS(blit(1, Graphics::FLIP_NONE, 0xFFFFFFFF, Graphics::BLEND_NORMAL), 0x80808080u);
+	}
+
+	void test_blit_normal_colormod() {
+		TS_ASSERT_EQUALS(blit(0, Graphics::FLIP_NONE, 0x80FFFFFF, Graphics::BLEND_NORMAL), 0x6E7E5FFFu);
+		TS_ASSERT_EQUALS(blit(1, Graphics::FLIP_NONE, 0x80FFFFFF, Graphics::BLEND_NORMAL), 0x80808080u);
+	}
+
+	void test_blit_flipped() {
+		TS_ASSERT_EQUALS(blit(0, Graphics::FLIP_H, 0xFFFFFFFF, Graphics::BLEND_NORMAL), 0x80808080u);
+		TS_ASSERT_EQUALS(blit(1, Graphics::FLIP_H, 0xFFFFFFFF, Graphics::BLEND_NORMAL), 0x5F7F3FFFu);
+	}
+
+	void test_blit_additive() {
+		TS_ASSERT_EQUALS(blit(0, Graphics::FLIP_NONE, 0xFFFFFFFF, Graphics::BLEND_ADDITIVE), 0xA0C08080u);
+		TS_ASSERT_EQUALS(blit(1, Graphics::FLIP_NONE, 0xFFFFFFFF, Graphics::BLEND_ADDITIVE), 0x80808080u);
+	}
+
+	void test_blit_additive_colormod() {
+		TS_ASSERT_EQUALS(blit(0, Graphics::FLIP_NONE, 0x80FFFFFF, Graphics::BLEND_ADDITIVE), 0x90A08080u);
+		TS_ASSERT_EQUALS(blit(1, Graphics::FLIP_NONE, 0x80FFFFFF, Graphics::BLEND_ADDITIVE), 0x80808080u);
+	}
+
+	void test_blit_subtractive() {
+		TS_ASSERT_EQUALS(blit(0, Graphics::FLIP_NONE, 0xFFFFFFFF, Graphics::BLEND_SUBTRACTIVE), 0x70608080u);
+		TS_ASSERT_EQUALS(blit(1, Graphics::FLIP_NONE, 0xFFFFFFFF, Graphics::BLEND_SUBTRACTIVE), 0x80808080u);
+	}
+
+	void test_blit_subtractive_colormod() {
+		TS_ASSERT_EQUALS(blit(0, Graphics::FLIP_NONE, 0x80FFFFFF, Graphics::BLEND_SUBTRACTIVE), 0x706080FFu);
+		TS_ASSERT_EQUALS(blit(1, Graphics::FLIP_NONE, 0x80FFFFFF, Graphics::BLEND_SUBTRACTIVE), 0x808080FFu);
+	}
+
+	void test_blit_multiply() {
+		TS_ASSERT_EQUALS(blit(0, Graphics::FLIP_NONE, 0xFFFFFFFF, Graphics::BLEND_MULTIPLY), 0x10200080u);
+		TS_ASSERT_EQUALS(blit(1, Graphics::FLIP_NONE, 0xFFFFFFFF, Graphics::BLEND_MULTIPLY), 0x80808080u);
+	}
+
+	void test_blit_multiply_colormod() {
+		TS_ASSERT_EQUALS(blit(0, Graphics::FLIP_NONE, 0x80FFFFFF, Graphics::BLEND_MULTIPLY), 0x08100080u);
+		TS_ASSERT_EQUALS(blit(1, Graphics::FLIP_NONE, 0x80FFFFFF, Graphics::BLEND_MULTIPLY), 0x00000080u);
+	}
+};
@@ -0,0 +1,79 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/surface.h"
+#include "graphics/yuv_to_rgb.h"
+
+/**
+ * Checks the (possibly vectorized) YUV420 conversion against the table
+ * based YUV444 conversion, fed with the same chroma samples upsampled.
+ */
+class YUVToRGBTestSuite : public CxxTest::TestSuite {
+	enum {
+		kWidth = 52,
+		kHeight = 6
+	};
+
+	byte _y[kWidth * kHeight];
+	byte _u420[kWidth / 2 * kHeight / 2], _v420[kWidth / 2 * kHeight / 2];
+	byte _u444[kWidth * kHeight], _v444[kWidth * kHeight];
+
+	void compare(const Graphics::PixelFormat &format, Graphics::YUVToRGBManager::LuminanceScale scale) {
+		Graphics::Surface surf420, surf444;
+		surf420.create(kWidth, kHeight, format);
+		surf444.create(kWidth, kHeight, format);
+
+		YUVToRGBMan.convert420(&surf420, scale, _y, _u420, _v420, kWidth, kHeight, kWidth, kWidth / 2);
+		YUVToRGBMan.convert444(&surf444, scale, _y, _u444, _v444, kWidth, kHeight, kWidth, kWidth);
+
+		for (int y = 0; y < kHeight; y++) {
+			const byte *line420 = (const byte *)surf420.getBasePtr(0, y);
+			const byte *line444 = (const byte *)surf444.getBasePtr(0, y);
+			TS_ASSERT_SAME_DATA(line420, line444, kWidth * format.bytesPerPixel);
+		}
+
+		surf420.free();
+		surf444.free();
+	}
+
+	public:
+	void setUp() {
+		// Cover the full range of chroma values, including the extremes
+		// that get clamped
+		for (int i = 0; i < kWidth * kHeight; i++)
+			_y[i] = (i * 37) & 0xFF;
+
+		for (int y = 0; y < kHeight / 2; y++) {
+			for (int x = 0; x < kWidth / 2; x++) {
+				const int index = y * kWidth / 2 + x;
+				_u420[index] = (index * 11) & 0xFF;
+				_v420[index] = 0xFF - ((index * 7) & 0xFF);
+
+				for (int i = 0; i < 4; i++) {
+					const int index444 = (y * 2 + (i >> 1)) * kWidth + x * 2 + (i & 1);
+					_u444[index444] = _u420[index];
+					_v444[index444] = _v420[index];
+				}
+			}
+		}
+	}
+
+	void test_convert420_rgb565() {
+		compare(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0), Graphics::YUVToRGBManager::kScaleFull);
+		compare(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0), Graphics::YUVToRGBManager::kScaleITU);
+	}
+
+	void test_convert420_rgb555() {
+		compare(Graphics::PixelFormat(2, 5, 5, 5, 0, 10, 5, 0, 0), Graphics::YUVToRGBManager::kScaleFull);
+		compare(Graphics::PixelFormat(2, 5, 5, 5, 0, 10, 5, 0, 0), Graphics::YUVToRGBManager::kScaleITU);
+	}
+
+	void test_convert420_xrgb8888() {
+		compare(Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0), Graphics::YUVToRGBManager::kScaleFull);
+		compare(Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0), Graphics::YUVToRGBManager::kScaleITU);
+	}
+
+	void test_convert420_rgba8888() {
+		compare(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), Graphics::YUVToRGBManager::kScaleFull);
+		compare(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), Graphics::YUVToRGBManager::kScaleITU);
+	}
+};